@@ -21,10 +21,24 @@
 #include "sst/core/stringize.h"
 #include "sst/core/timeConverter.h"
 
+#include "nlohmann/json.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
 #include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+namespace json = ::nlohmann;
+
 namespace SST {
 
 namespace pvt {
@@ -64,13 +78,59 @@ createNameFromFormat(const std::string& format, const std::string& prefix, uint6
     return ret;
 }
 
+#ifdef SST_CONFIG_HAVE_MPI
+// Communicator for the ranks that share a checkpoint file
+MPI_Comm aggregate_comm = MPI_COMM_NULL;
+
+/**
+   Append the data of every rank in comm to the data on the first rank
+   of comm, in rank order.  Data is sent in pieces since MPI counts
+   are ints.
+ */
+void
+gatherToRoot(std::vector<char>& data, MPI_Comm comm)
+{
+    int rank;
+    int size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    const uint64_t        piece = 1 << 30;
+    uint64_t              local = data.size();
+    std::vector<uint64_t> sizes(size);
+    MPI_Gather(&local, 1, MPI_UINT64_T, sizes.data(), 1, MPI_UINT64_T, 0, comm);
+
+    if ( rank == 0 ) {
+        for ( int r = 1; r < size; ++r ) {
+            size_t start = data.size();
+            data.resize(start + sizes[r]);
+            for ( uint64_t done = 0; done < sizes[r]; done += piece ) {
+                MPI_Recv(data.data() + start + done, (int)std::min(piece, sizes[r] - done), MPI_BYTE, r, 0, comm,
+                    MPI_STATUS_IGNORE);
+            }
+        }
+    }
+    else {
+        for ( uint64_t done = 0; done < local; done += piece ) {
+            MPI_Send(data.data() + done, (int)std::min(piece, local - done), MPI_BYTE, 0, 0, comm);
+        }
+    }
+}
+#endif
+
 } // namespace pvt
 
 CheckpointAction::CheckpointAction(Config* cfg, RankInfo this_rank, Simulation* sim, TimeConverter period) :
     Action(),
     rank_(this_rank),
     period_(period),
-    generate_(false)
+    generate_(false),
+    async_(cfg->checkpoint_async()),
+    incremental_(cfg->checkpoint_incremental()),
+    aggregate_(cfg->checkpoint_aggregate()),
+    compress_(cfg->checkpoint_compress() && Checkpointing::compressionAvailable()),
+    memory_(cfg->checkpoint_memory()),
+    profile_(cfg->checkpoint_profile())
 {
     // Set the priority to be the same as the SyncManager so that
     // checkpointing happens in the same place for both serial and
@@ -106,18 +166,42 @@ CheckpointAction::CheckpointAction(Config* cfg, RankInfo this_rank, Simulation*
         file_format_ = format.substr(split + 1);
     }
 
-    if ( (0 == this_rank.rank) ) {
-        // Check to make sure that there is at least one of %n or %t to
-        // make checkpoint filenames unique.
-        bool unique = false;
-        if ( format.find("%n") != format.npos ) unique = true;
-        if ( format.find("%t") != format.npos ) unique = true;
+    // Check to make sure that there is at least one of %n or %t to
+    // make checkpoint filenames unique.
+    bool unique = false;
+    if ( format.find("%n") != format.npos ) unique = true;
+    if ( format.find("%t") != format.npos ) unique = true;
 
+    // Incremental checkpoints refer to the files of earlier
+    // checkpoints, so they can't be overwritten
+    if ( !unique ) incremental_ = false;
+
+    // Memory checkpoints can only be restarted on a single rank, since
+    // each rank would hold part of them, and they are dropped from
+    // memory so they can't be referred to by incremental checkpoints
+    if ( sim->getNumRanks().rank > 1 ) memory_ = 0;
+    if ( memory_ ) incremental_ = false;
+
+    if ( (0 == this_rank.rank) ) {
         if ( !unique ) {
             sim->getSimulationOutput().output(
                 "WARNING: checkpoint-name-format does not include one of %%n or %%t, which means that all checkpoints "
                 "will use the same filename and previous files will be overwritten [%s].\n",
                 format.c_str());
+            if ( cfg->checkpoint_incremental() && 0 == this_rank.thread ) {
+                sim->getSimulationOutput().output(
+                    "WARNING: checkpoint-incremental is ignored because checkpoint filenames are not unique.\n");
+            }
+        }
+
+        if ( cfg->checkpoint_memory() && !memory_ && 0 == this_rank.thread ) {
+            sim->getSimulationOutput().output(
+                "WARNING: checkpoint-memory is ignored because it is only supported for single rank runs.\n");
+        }
+
+        if ( cfg->checkpoint_compress() && !Checkpointing::compressionAvailable() && 0 == this_rank.thread ) {
+            sim->getSimulationOutput().output("WARNING: checkpoint-compress is ignored because SST was built "
+                                              "without zlib.\n");
         }
 
         last_cpu_time_ = sst_get_cpu_time();
@@ -154,6 +238,19 @@ CheckpointAction::execute()
 void
 CheckpointAction::createCheckpoint(Simulation* sim)
 {
+    double start_time = 0.0;
+    if ( 0 == rank_.thread ) {
+        // Files from the previous checkpoint need to be written
+        // before new ones are queued
+        finishWrites();
+        start_time = sst_get_cpu_time();
+    }
+
+    if ( profile_ ) {
+        checkpoint_profile_.clear();
+        Checkpointing::setActiveProfile(&checkpoint_profile_);
+    }
+
     if ( 0 == rank_.rank && 0 == rank_.thread ) {
         const double now = sst_get_cpu_time();
         sim->getSimulationOutput().output(
@@ -174,8 +271,22 @@ CheckpointAction::createCheckpoint(Simulation* sim)
 
     // Only thread 0 will participate in setup
     if ( rank_.thread == 0 ) {
+        rank_profile_.clear();
+
+        // Memory checkpoints capture the files instead of writing them
+        if ( memory_ ) {
+            memory_checkpoints.push_back(std::make_unique<Checkpointing::MemoryCheckpoint>());
+            // The checkpoint being rewound to is kept until the
+            // simulation has been restarted from it
+            while ( memory_checkpoints.size() > memory_ && memory_checkpoints.front().get() != rewind_checkpoint ) {
+                memory_checkpoints.pop_front();
+            }
+            memory_checkpoints.back()->time = sim->currentSimCycle;
+            Checkpointing::setCapture(memory_checkpoints.back().get());
+        }
+
         // Rank 0 will create the directory for this checkpoint
-        if ( rank_.rank == 0 ) {
+        if ( rank_.rank == 0 && !memory_ ) {
             directory = sim->checkpoint_directory_ + "/" + basename;
             std::filesystem::create_directory(directory);
         }
@@ -187,15 +298,29 @@ CheckpointAction::createCheckpoint(Simulation* sim)
     // Get the basename for the files
     basename = pvt::createNameFromFormat(file_format_, prefix, checkpoint_id, sim->currentSimCycle);
 
-    // Add the rank and thread info to the name
-    std::string filename = basename + "_" + std::to_string(rank_.rank) + "_" + std::to_string(rank_.thread) + ".bin";
+    // Add the rank and thread info to the name.  Shared files are
+    // named after the first rank of their aggregation group.
+    std::string filename;
+    if ( aggregate_ ) {
+        filename = basename + "_" + std::to_string(rank_.rank - rank_.rank % aggregate_) + ".bin";
+    }
+    else {
+        filename = basename + "_" + std::to_string(rank_.rank) + "_" + std::to_string(rank_.thread) + ".bin";
+    }
 
     barrier.wait();
 
     if ( rank_.thread == 0 ) checkpoint_id++;
 
-    // Write out the checkpoints for the partitions
-    sim->checkpoint(directory + "/" + filename);
+    // Write out the checkpoints for the partitions.  In shared files,
+    // the registry also records where the partition's data starts.
+    std::string registry_entry = filename;
+    if ( aggregate_ ) {
+        registry_entry += " @ " + std::to_string(writeAggregated(sim, directory + "/" + filename));
+    }
+    else {
+        sim->checkpoint(directory + "/" + filename, incremental_);
+    }
 
     // Write out the registry.  Rank 0 thread 0 will write the global
     // state and its registry, then each thread will take a turn
@@ -207,7 +332,20 @@ CheckpointAction::createCheckpoint(Simulation* sim)
     // Need to write out the globals
     // Only rank0/thread0 writes, but all may need to participate in global data gather
     std::string globals_name = basename + "_globals.bin";
-    sim->checkpoint_write_globals(checkpoint_id - 1, directory, registry_name, globals_name);
+    std::string index_name   = basename + ".sstidx";
+    std::string profile_name = basename + "_profile.json";
+
+    // The registry and index mark the checkpoint as complete, so when
+    // the data files are written in the background, they are written
+    // under a temporary name and renamed by finishWrites() once all
+    // the data has been written
+    const std::string pending_suffix = (async_ && !memory_) ? ".pending" : "";
+    if ( !pending_suffix.empty() && 0 == rank_.rank && 0 == rank_.thread ) {
+        pending_files_.push_back(directory + "/" + registry_name);
+        pending_files_.push_back(directory + "/" + index_name);
+    }
+    sim->checkpoint_write_globals(
+        checkpoint_id - 1, directory, registry_name + pending_suffix, globals_name, index_name);
 
     // No need to barrier here since rank 0 thread 0 will be the first
     // to execute in the loop below and everything else will wait
@@ -217,7 +355,14 @@ CheckpointAction::createCheckpoint(Simulation* sim)
             for ( uint32_t t = 0; t < num_ranks.thread; ++t ) {
                 // If this is my thread go ahead
                 if ( t == rank_.thread ) {
-                    sim->checkpoint_append_registry(directory + "/" + registry_name, filename);
+                    sim->checkpoint_append_registry(
+                        directory + "/" + registry_name + pending_suffix, registry_entry);
+                    Checkpointing::appendComponentIndex(directory + "/" + index_name + pending_suffix,
+                        r == 0 && t == 0, filename, sim->component_blob_offsets_, sim->component_blob_sizes_);
+                    if ( profile_ ) {
+                        rank_profile_.merge(checkpoint_profile_);
+                        profile.merge(checkpoint_profile_);
+                    }
                     barrier.wait();
                 }
                 else {
@@ -248,6 +393,147 @@ CheckpointAction::createCheckpoint(Simulation* sim)
 #endif
         }
     }
+
+    // All the partitions have been added to the index, so it can be
+    // sorted
+    if ( 0 == rank_.rank && 0 == rank_.thread ) {
+        Checkpointing::finalizeComponentIndex(directory + "/" + index_name + pending_suffix);
+    }
+
+    // The profiles of all the partitions are summed and rank 0
+    // writes the checkpoint's profile
+    if ( profile_ && 0 == rank_.thread ) {
+        Checkpointing::reduceCheckpointProfile(rank_profile_);
+        if ( 0 == rank_.rank ) {
+            Checkpointing::writeCheckpointProfile(
+                directory + "/" + profile_name, rank_profile_, uint64_t(num_ranks.rank) * num_ranks.thread);
+        }
+    }
+
+    if ( profile_ ) Checkpointing::setActiveProfile(nullptr);
+
+    if ( memory_ && 0 == rank_.thread ) {
+        memory_checkpoints.back()->registry = directory + "/" + registry_name;
+        Checkpointing::setCapture(nullptr);
+    }
+
+    if ( 0 == rank_.thread ) {
+        double stall = sst_get_cpu_time() - start_time;
+        times.count++;
+        times.stall += stall;
+        times.max_stall = std::max(times.max_stall, stall);
+        if ( async_ ) {
+            pending_start_ = start_time;
+            pending_stall_ = stall;
+        }
+        else {
+            times.write += stall;
+            times.max_write = std::max(times.max_write, stall);
+        }
+    }
+}
+
+uint64_t
+CheckpointAction::writeAggregated(Simulation* sim, const std::string& filename)
+{
+    if ( rank_.thread == 0 ) {
+        aggregate_images_.resize(sim->getNumRanks().thread);
+    }
+    barrier.wait();
+
+    // Each thread serializes its own partition
+    sim->checkpoint(filename, incremental_, &aggregate_images_[rank_.thread]);
+    barrier.wait();
+
+    // Find where this rank's data starts in the shared file.  Ranks
+    // are placed in rank order, followed by their threads in order.
+    if ( rank_.thread == 0 ) {
+        aggregate_rank_base_ = 0;
+#ifdef SST_CONFIG_HAVE_MPI
+        if ( pvt::aggregate_comm == MPI_COMM_NULL ) {
+            MPI_Comm_split(MPI_COMM_WORLD, rank_.rank / aggregate_, rank_.rank, &pvt::aggregate_comm);
+        }
+        uint64_t rank_size = 0;
+        for ( auto& image : aggregate_images_ )
+            rank_size += image.size();
+        MPI_Exscan(&rank_size, &aggregate_rank_base_, 1, MPI_UINT64_T, MPI_SUM, pvt::aggregate_comm);
+        // MPI_Exscan leaves the result undefined on the first rank
+        if ( rank_.rank % aggregate_ == 0 ) aggregate_rank_base_ = 0;
+#endif
+
+        // The first rank in the group creates the file before any
+        // partition writes into it
+        if ( !compress_ ) {
+            if ( rank_.rank % aggregate_ == 0 ) Checkpointing::writeFile(filename, nullptr, 0);
+#ifdef SST_CONFIG_HAVE_MPI
+            MPI_Barrier(pvt::aggregate_comm);
+#endif
+        }
+    }
+    barrier.wait();
+
+    uint64_t base = aggregate_rank_base_;
+    for ( uint32_t t = 0; t < rank_.thread; ++t )
+        base += aggregate_images_[t].size();
+    sim->checkpoint_relocate(base);
+    barrier.wait();
+
+    if ( !compress_ ) {
+        // Each partition writes its own data, so no rank holds more
+        // than the data of its own partitions
+        std::vector<char> data = std::move(aggregate_images_[rank_.thread]);
+        if ( async_ && !Checkpointing::isCapturing() ) {
+            writer.write(filename, base, std::move(data));
+        }
+        else {
+            Checkpointing::writeFileAt(filename, base, data.data(), data.size());
+        }
+        return base;
+    }
+
+    // Compressed files are compressed as a whole, so thread 0 collects
+    // the data for the rank and the first rank in the group writes the
+    // file
+    if ( rank_.thread == 0 ) {
+        std::vector<char> data = std::move(aggregate_images_[0]);
+        for ( size_t t = 1; t < aggregate_images_.size(); ++t ) {
+            data.insert(data.end(), aggregate_images_[t].begin(), aggregate_images_[t].end());
+        }
+        aggregate_images_.clear();
+
+#ifdef SST_CONFIG_HAVE_MPI
+        pvt::gatherToRoot(data, pvt::aggregate_comm);
+        if ( rank_.rank % aggregate_ != 0 ) return base;
+#endif
+        sim->checkpoint_write_file(filename, std::move(data));
+    }
+    return base;
+}
+
+void
+CheckpointAction::finishWrites()
+{
+    if ( pending_start_ < 0.0 ) return;
+
+    double write = std::max(writer.wait() - pending_start_, pending_stall_);
+    times.write += write;
+    times.max_write = std::max(times.max_write, write);
+    pending_start_  = -1.0;
+
+    // Every rank has written its data files, so the checkpoint can be
+    // marked complete
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    for ( auto& file : pending_files_ ) {
+        std::error_code ec;
+        std::filesystem::rename(file + ".pending", file, ec);
+        if ( ec ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ERROR: Unable to rename %s.pending: %s\n", file.c_str(), ec.message().c_str());
+        }
+    }
+    pending_files_.clear();
 }
 
 // SyncManager check whether a checkpoint needs to be generated
@@ -295,8 +581,20 @@ CheckpointAction::getNextCheckpointSimTime()
     return next_sim_time_;
 }
 
-Core::ThreadSafe::Barrier CheckpointAction::barrier;
-uint32_t                  CheckpointAction::checkpoint_id = 1;
+Core::ThreadSafe::Barrier         CheckpointAction::barrier;
+uint32_t                          CheckpointAction::checkpoint_id = 1;
+Checkpointing::AsyncWriter        CheckpointAction::writer;
+CheckpointAction::CheckpointTimes CheckpointAction::times;
+Checkpointing::CheckpointProfile  CheckpointAction::profile;
+Checkpointing::CheckpointProfile  CheckpointAction::rank_profile_;
+double                            CheckpointAction::pending_start_ = -1.0;
+double                            CheckpointAction::pending_stall_ = 0.0;
+std::vector<std::string>          CheckpointAction::pending_files_;
+
+std::deque<std::unique_ptr<Checkpointing::MemoryCheckpoint>> CheckpointAction::memory_checkpoints;
+Checkpointing::MemoryCheckpoint*                             CheckpointAction::rewind_checkpoint = nullptr;
+std::vector<std::vector<char>>                               CheckpointAction::aggregate_images_;
+uint64_t                                                     CheckpointAction::aggregate_rank_base_ = 0;
 
 namespace Checkpointing {
 
@@ -363,6 +661,754 @@ initializeCheckpointInfrastructure(Config* cfg, bool can_ckpt, int myRank)
     return checkpoint_dir_name;
 }
 
+namespace {
+
+/*
+  Compressed checkpoint file layout.  All values are native uint64_t
+  unless noted:
+
+    magic (8 bytes)
+    chunk*            codec (uint8_t), raw size, compressed size, data
+    index             raw size of file, number of chunks,
+                      (file offset, raw offset, raw size) per chunk
+    index offset
+    magic (8 bytes)
+
+  Offsets of components in the checkpoint registry are offsets into
+  the uncompressed data.
+*/
+const char    compressed_magic[8] = { 'S', 'S', 'T', 'C', 'P', 'T', 'Z', '1' };
+const size_t  chunk_size          = 1024 * 1024;
+const uint8_t codec_stored        = 0;
+const uint8_t codec_zlib          = 1;
+
+template <typename T>
+void
+append(std::vector<char>& out, const T& value)
+{
+    const char* bytes = reinterpret_cast<const char*>(&value);
+    out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+T
+readValue(std::istream& in)
+{
+    T value {};
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+}
+
+/**
+   Stream over the uncompressed contents of a compressed checkpoint
+   file.  Only the chunk holding the current position is kept in
+   memory.
+ */
+class CompressedStream : public std::istream
+{
+    class Buffer : public std::streambuf
+    {
+    public:
+        struct Chunk
+        {
+            uint64_t file_offset;
+            uint64_t raw_offset;
+            uint64_t raw_size;
+        };
+
+        Buffer(std::unique_ptr<std::istream>&& file, std::vector<Chunk>&& chunks, uint64_t raw_size) :
+            file_(std::move(file)),
+            chunks_(std::move(chunks)),
+            raw_size_(raw_size)
+        {
+            loadChunk(0);
+        }
+
+    protected:
+        int_type underflow() override
+        {
+            if ( gptr() < egptr() ) return traits_type::to_int_type(*gptr());
+            if ( current_ + 1 >= chunks_.size() ) return traits_type::eof();
+            loadChunk(current_ + 1);
+            return traits_type::to_int_type(*gptr());
+        }
+
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode) override
+        {
+            off_type base = 0;
+            if ( dir == std::ios_base::cur )
+                base = position();
+            else if ( dir == std::ios_base::end )
+                base = raw_size_;
+            return seekTo(base + off);
+        }
+
+        pos_type seekpos(pos_type pos, std::ios_base::openmode) override { return seekTo(off_type(pos)); }
+
+    private:
+        off_type position() const
+        {
+            if ( current_ >= chunks_.size() ) return raw_size_;
+            return chunks_[current_].raw_offset + (gptr() - eback());
+        }
+
+        pos_type seekTo(off_type pos)
+        {
+            if ( pos < 0 || (uint64_t)pos > raw_size_ ) return pos_type(off_type(-1));
+            auto chunk = std::upper_bound(chunks_.begin(), chunks_.end(), (uint64_t)pos,
+                             [](uint64_t p, const Chunk& c) { return p < c.raw_offset; }) -
+                         chunks_.begin() - 1;
+            if ( chunk < 0 ) chunk = 0;
+            if ( (size_t)chunk != current_ ) loadChunk(chunk);
+            if ( current_ < chunks_.size() ) {
+                setg(eback(), eback() + (pos - chunks_[current_].raw_offset), egptr());
+            }
+            return pos_type(pos);
+        }
+
+        void loadChunk(size_t index)
+        {
+            current_ = index;
+            if ( index >= chunks_.size() ) {
+                data_.clear();
+                setg(data_.data(), data_.data(), data_.data());
+                return;
+            }
+
+            Output& out = Output::getDefaultObject();
+            file_->clear();
+            file_->seekg(chunks_[index].file_offset);
+            uint8_t  codec     = readValue<uint8_t>(*file_);
+            uint64_t raw_size  = readValue<uint64_t>(*file_);
+            uint64_t comp_size = readValue<uint64_t>(*file_);
+            if ( !*file_ || raw_size != chunks_[index].raw_size ) {
+                out.fatal(CALL_INFO, 1, "ERROR: Corrupt chunk in compressed checkpoint file\n");
+            }
+
+            data_.resize(raw_size);
+            if ( codec == codec_stored ) {
+                file_->read(data_.data(), raw_size);
+            }
+            else if ( codec == codec_zlib ) {
+#ifdef HAVE_LIBZ
+                comp_.resize(comp_size);
+                file_->read(comp_.data(), comp_size);
+                uLongf dest_size = raw_size;
+                int    rc        = uncompress(reinterpret_cast<Bytef*>(data_.data()), &dest_size,
+                              reinterpret_cast<const Bytef*>(comp_.data()), comp_size);
+                if ( rc != Z_OK || dest_size != raw_size ) {
+                    out.fatal(
+                        CALL_INFO, 1, "ERROR: Unable to decompress chunk in checkpoint file (zlib error %d)\n", rc);
+                }
+#else
+                out.fatal(CALL_INFO, 1,
+                    "ERROR: Checkpoint file is compressed with zlib, but this build of SST does not include zlib\n");
+#endif
+            }
+            else {
+                out.fatal(CALL_INFO, 1, "ERROR: Unknown compression codec %d in checkpoint file\n", (int)codec);
+            }
+            setg(data_.data(), data_.data(), data_.data() + data_.size());
+        }
+
+        std::unique_ptr<std::istream> file_;
+        std::vector<Chunk>            chunks_;
+        uint64_t                      raw_size_;
+        size_t                        current_ = 0;
+        std::vector<char>             data_;
+        std::vector<char>             comp_;
+    };
+
+public:
+    CompressedStream(std::unique_ptr<std::istream>&& file, std::vector<Buffer::Chunk>&& chunks, uint64_t raw_size) :
+        std::istream(nullptr),
+        buffer_(std::move(file), std::move(chunks), raw_size)
+    {
+        rdbuf(&buffer_);
+    }
+
+    using Chunk = Buffer::Chunk;
+
+private:
+    Buffer buffer_;
+};
+
+/**
+   Stream over a memory mapped file, used for uncompressed checkpoint
+   files so that only the pages holding the data that is read are
+   brought in.  Also used to read the files of a memory checkpoint,
+   which are not unmapped.
+ */
+class MappedStream : public std::istream
+{
+    class Buffer : public std::streambuf
+    {
+    public:
+        Buffer(char* data, size_t size, bool mapped) :
+            data_(data),
+            size_(size),
+            mapped_(mapped)
+        {
+            setg(data_, data_, data_ + size_);
+        }
+
+        ~Buffer()
+        {
+            if ( mapped_ ) munmap(data_, size_);
+        }
+
+    protected:
+        pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode) override
+        {
+            off_type base = 0;
+            if ( dir == std::ios_base::cur )
+                base = gptr() - eback();
+            else if ( dir == std::ios_base::end )
+                base = size_;
+            return seekpos(pos_type(base + off), std::ios_base::in);
+        }
+
+        pos_type seekpos(pos_type pos, std::ios_base::openmode) override
+        {
+            if ( off_type(pos) < 0 || size_t(off_type(pos)) > size_ ) return pos_type(off_type(-1));
+            setg(eback(), eback() + off_type(pos), egptr());
+            return pos;
+        }
+
+    private:
+        char*  data_;
+        size_t size_;
+        bool   mapped_;
+    };
+
+public:
+    MappedStream(char* data, size_t size, bool mapped = true) :
+        std::istream(nullptr),
+        buffer_(data, size, mapped)
+    {
+        rdbuf(&buffer_);
+    }
+
+private:
+    Buffer buffer_;
+};
+
+/**
+   Map a file for reading
+
+   @return Stream over the file or nullptr if it could not be mapped
+ */
+std::unique_ptr<std::istream>
+mapFile(const std::string& filename)
+{
+    int fd = open(filename.c_str(), O_RDONLY);
+    if ( fd < 0 ) return nullptr;
+
+    struct stat st;
+    if ( fstat(fd, &st) != 0 || st.st_size == 0 ) {
+        close(fd);
+        return nullptr;
+    }
+
+    void* addr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if ( addr == MAP_FAILED ) return nullptr;
+    return std::make_unique<MappedStream>(static_cast<char*>(addr), st.st_size);
+}
+
+/*
+  The component index is written in two steps.  While the registry is
+  written, each partition appends
+
+    file name length, file name, number of components,
+    (id, offset, size) per component
+
+  to the index file.  Rank 0 then rewrites it in the final format,
+  sorted by component id:
+
+    magic (8 bytes), number of files, (name length, name) per file,
+    number of components, (id, file, offset, size) per component
+*/
+const char index_magic[8] = { 'S', 'S', 'T', 'C', 'I', 'D', 'X', '1' };
+
+// Memory checkpoint being captured, if any
+MemoryCheckpoint* capture = nullptr;
+
+// Memory checkpoint that files are read from, if any
+const MemoryCheckpoint* source = nullptr;
+
+// Profile of the checkpoint being written by this thread, if any
+thread_local CheckpointProfile* active_profile = nullptr;
+
+} // namespace
+
+void
+setCapture(MemoryCheckpoint* checkpoint)
+{
+    capture = checkpoint;
+}
+
+bool
+isCapturing()
+{
+    return capture != nullptr;
+}
+
+void
+setSource(const MemoryCheckpoint* checkpoint)
+{
+    source = checkpoint;
+}
+
+void
+writeFile(const std::string& filename, const char* data, size_t size, bool append)
+{
+    if ( capture ) {
+        std::lock_guard<std::mutex> lock(capture->lock);
+        std::vector<char>&          file = capture->files[filename];
+        if ( !append ) file.clear();
+        file.insert(file.end(), data, data + size);
+        return;
+    }
+
+    std::ofstream fs = Simulation::filesystem.ofstream(
+        filename, std::ios::out | std::ios::binary | (append ? std::ios::app : std::ios::trunc));
+    if ( !fs.is_open() ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "ERROR: Unable to open checkpoint file %s for writing\n", filename.c_str());
+    }
+    fs.write(data, size);
+    fs.close();
+    if ( !fs ) {
+        Output::getDefaultObject().fatal(CALL_INFO, 1, "ERROR: Error writing checkpoint file %s\n", filename.c_str());
+    }
+}
+
+void
+writeFileAt(const std::string& filename, uint64_t offset, const char* data, size_t size)
+{
+    if ( capture ) {
+        std::lock_guard<std::mutex> lock(capture->lock);
+        std::vector<char>&          file = capture->files[filename];
+        if ( file.size() < offset + size ) file.resize(offset + size);
+        std::copy(data, data + size, file.begin() + offset);
+        return;
+    }
+
+    std::ofstream fs = Simulation::filesystem.ofstream(filename, std::ios::in | std::ios::out | std::ios::binary);
+    if ( !fs.is_open() ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "ERROR: Unable to open checkpoint file %s for writing\n", filename.c_str());
+    }
+    fs.seekp(offset);
+    fs.write(data, size);
+    fs.close();
+    if ( !fs ) {
+        Output::getDefaultObject().fatal(CALL_INFO, 1, "ERROR: Error writing checkpoint file %s\n", filename.c_str());
+    }
+}
+
+void
+readFile(const std::string& filename, std::vector<char>& data)
+{
+    if ( capture ) {
+        std::lock_guard<std::mutex> lock(capture->lock);
+        data = capture->files[filename];
+        return;
+    }
+
+    std::ifstream fs(filename, std::ios::binary | std::ios::ate);
+    data.resize(fs.is_open() ? static_cast<size_t>(fs.tellg()) : 0);
+    fs.seekg(0);
+    fs.read(data.data(), data.size());
+}
+
+bool
+compressionAvailable()
+{
+#ifdef HAVE_LIBZ
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::vector<char>
+compressFile(const std::vector<char>& data)
+{
+    std::vector<char> out;
+    out.insert(out.end(), compressed_magic, compressed_magic + sizeof(compressed_magic));
+
+    // File offset of each chunk
+    std::vector<uint64_t> chunk_offsets;
+    for ( size_t raw_offset = 0; raw_offset < data.size(); raw_offset += chunk_size ) {
+        size_t raw_size = std::min(chunk_size, data.size() - raw_offset);
+        chunk_offsets.push_back(out.size());
+
+        size_t header = out.size();
+        append(out, codec_stored);
+        append(out, (uint64_t)raw_size);
+        append(out, (uint64_t)raw_size);
+
+#ifdef HAVE_LIBZ
+        uLongf comp_size = compressBound(raw_size);
+        out.resize(header + sizeof(uint8_t) + 2 * sizeof(uint64_t) + comp_size);
+        char* dest = out.data() + header + sizeof(uint8_t) + 2 * sizeof(uint64_t);
+        int   rc   = compress2(reinterpret_cast<Bytef*>(dest), &comp_size,
+                reinterpret_cast<const Bytef*>(data.data() + raw_offset), raw_size, Z_BEST_SPEED);
+        // Keep the chunk compressed only if that made it smaller
+        if ( rc == Z_OK && comp_size < raw_size ) {
+            out.resize(header + sizeof(uint8_t) + 2 * sizeof(uint64_t) + comp_size);
+            out[header]       = codec_zlib;
+            uint64_t size_u64 = comp_size;
+            memcpy(out.data() + header + sizeof(uint8_t) + sizeof(uint64_t), &size_u64, sizeof(size_u64));
+            continue;
+        }
+        out.resize(header + sizeof(uint8_t) + 2 * sizeof(uint64_t));
+#endif
+        out.insert(out.end(), data.begin() + raw_offset, data.begin() + raw_offset + raw_size);
+    }
+
+    uint64_t index_offset = out.size();
+    append(out, (uint64_t)data.size());
+    append(out, (uint64_t)chunk_offsets.size());
+    for ( size_t i = 0; i < chunk_offsets.size(); ++i ) {
+        uint64_t raw_offset = i * chunk_size;
+        append(out, chunk_offsets[i]);
+        append(out, raw_offset);
+        append(out, (uint64_t)std::min(chunk_size, data.size() - raw_offset));
+    }
+    append(out, index_offset);
+    out.insert(out.end(), compressed_magic, compressed_magic + sizeof(compressed_magic));
+    return out;
+}
+
+std::unique_ptr<std::istream>
+openCheckpointFile(const std::string& filename)
+{
+    std::unique_ptr<std::istream> fs;
+    bool                          is_open = true;
+    if ( source ) {
+        // Files of a memory checkpoint are read where they are held
+        auto file = source->files.find(filename);
+        if ( file == source->files.end() ) {
+            fs = std::make_unique<std::istringstream>();
+            fs->setstate(std::ios::failbit);
+            return fs;
+        }
+        fs = std::make_unique<MappedStream>(const_cast<char*>(file->second.data()), file->second.size(), false);
+    }
+    else {
+        auto file = std::make_unique<std::ifstream>(filename, std::ios::binary);
+        is_open   = file->is_open();
+        fs        = std::move(file);
+    }
+
+    char magic[sizeof(compressed_magic)] = {};
+    fs->read(magic, sizeof(magic));
+    if ( !*fs || memcmp(magic, compressed_magic, sizeof(magic)) != 0 ) {
+        // Not compressed, so map the file.  If that fails (or the
+        // file isn't readable), just use the file stream.
+        if ( !source ) {
+            auto mapped = mapFile(filename);
+            if ( mapped ) return mapped;
+        }
+        if ( is_open ) {
+            fs->clear();
+            fs->seekg(0);
+        }
+        return fs;
+    }
+
+    // Read the chunk table from the index
+    fs->seekg(-(std::streamoff)(sizeof(uint64_t) + sizeof(compressed_magic)), std::ios_base::end);
+    uint64_t index_offset = readValue<uint64_t>(*fs);
+    fs->seekg(index_offset);
+    uint64_t raw_size   = readValue<uint64_t>(*fs);
+    uint64_t num_chunks = readValue<uint64_t>(*fs);
+
+    std::vector<CompressedStream::Chunk> chunks(num_chunks);
+    for ( auto& chunk : chunks ) {
+        chunk.file_offset = readValue<uint64_t>(*fs);
+        chunk.raw_offset  = readValue<uint64_t>(*fs);
+        chunk.raw_size    = readValue<uint64_t>(*fs);
+    }
+    if ( !*fs ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "ERROR: Corrupt index in compressed checkpoint file %s\n", filename.c_str());
+    }
+
+    return std::make_unique<CompressedStream>(std::move(fs), std::move(chunks), raw_size);
+}
+
+void
+appendComponentIndex(const std::string& index_filename, bool first, const std::string& blob_filename,
+    const std::vector<std::pair<ComponentId_t, uint64_t>>& offsets, const std::vector<uint64_t>& sizes)
+{
+    std::vector<char> out;
+    append(out, (uint64_t)blob_filename.size());
+    out.insert(out.end(), blob_filename.begin(), blob_filename.end());
+    append(out, (uint64_t)offsets.size());
+    for ( size_t i = 0; i < offsets.size(); ++i ) {
+        append(out, (uint64_t)offsets[i].first);
+        append(out, (uint64_t)offsets[i].second);
+        append(out, (uint64_t)sizes[i]);
+    }
+    writeFile(index_filename, out.data(), out.size(), !first);
+}
+
+void
+finalizeComponentIndex(const std::string& index_filename)
+{
+    ComponentIndex index;
+    {
+        std::vector<char> data;
+        readFile(index_filename, data);
+        std::istringstream fs(std::string(data.begin(), data.end()));
+        while ( fs.peek() != std::istringstream::traits_type::eof() ) {
+            std::string file(readValue<uint64_t>(fs), '\0');
+            fs.read(&file[0], file.size());
+            uint64_t count = readValue<uint64_t>(fs);
+
+            // Aggregated files are listed once per partition
+            uint64_t file_index = index.files.size();
+            if ( index.files.empty() || index.files.back() != file )
+                index.files.push_back(file);
+            else
+                file_index--;
+
+            for ( uint64_t i = 0; i < count; ++i ) {
+                ComponentIndex::Entry entry;
+                entry.id     = readValue<uint64_t>(fs);
+                entry.file   = file_index;
+                entry.offset = readValue<uint64_t>(fs);
+                entry.size   = readValue<uint64_t>(fs);
+                index.components.push_back(entry);
+            }
+        }
+    }
+
+    std::sort(index.components.begin(), index.components.end(),
+        [](const ComponentIndex::Entry& a, const ComponentIndex::Entry& b) { return a.id < b.id; });
+
+    std::vector<char> out;
+    out.insert(out.end(), index_magic, index_magic + sizeof(index_magic));
+    append(out, (uint64_t)index.files.size());
+    for ( auto& file : index.files ) {
+        append(out, (uint64_t)file.size());
+        out.insert(out.end(), file.begin(), file.end());
+    }
+    append(out, (uint64_t)index.components.size());
+    const char* entries = reinterpret_cast<const char*>(index.components.data());
+    out.insert(out.end(), entries, entries + index.components.size() * sizeof(ComponentIndex::Entry));
+    writeFile(index_filename, out.data(), out.size());
+}
+
+bool
+readComponentIndex(const std::string& index_filename, ComponentIndex& index)
+{
+    std::ifstream fs(index_filename, std::ios::binary);
+    char          magic[sizeof(index_magic)] = {};
+    fs.read(magic, sizeof(magic));
+    if ( !fs || memcmp(magic, index_magic, sizeof(magic)) != 0 ) return false;
+
+    index.files.resize(readValue<uint64_t>(fs));
+    for ( auto& file : index.files ) {
+        file.resize(readValue<uint64_t>(fs));
+        fs.read(&file[0], file.size());
+    }
+    index.components.resize(readValue<uint64_t>(fs));
+    fs.read(reinterpret_cast<char*>(index.components.data()), index.components.size() * sizeof(ComponentIndex::Entry));
+    return !fs.fail();
+}
+
+void
+CheckpointProfile::clear()
+{
+    sections.clear();
+    types.clear();
+    tracking = {};
+}
+
+void
+CheckpointProfile::merge(const CheckpointProfile& other)
+{
+    auto add = [](std::map<std::string, Entry>& to, const std::map<std::string, Entry>& from) {
+        for ( auto& [name, entry] : from ) {
+            Entry& total = to[name];
+            total.count += entry.count;
+            total.bytes += entry.bytes;
+            total.time += entry.time;
+        }
+    };
+    add(sections, other.sections);
+    add(types, other.types);
+
+    tracking.tables += other.tracking.tables;
+    tracking.pointers += other.tracking.pointers;
+    tracking.max_pointers = std::max(tracking.max_pointers, other.tracking.max_pointers);
+    tracking.capacity += other.tracking.capacity;
+    tracking.lookups += other.tracking.lookups;
+    tracking.hits += other.tracking.hits;
+    tracking.probes += other.tracking.probes;
+    tracking.shared_ptr_owners += other.tracking.shared_ptr_owners;
+}
+
+CheckpointProfile*
+activeProfile()
+{
+    return active_profile;
+}
+
+void
+setActiveProfile(CheckpointProfile* profile)
+{
+    active_profile = profile;
+}
+
+void
+reduceCheckpointProfile(CheckpointProfile& profile)
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    int rank = 0, world = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &world);
+
+    // At each step, the ranks that are a multiple of 2 * step receive
+    // the total of the next step ranks
+    for ( int step = 1; step < world; step *= 2 ) {
+        if ( rank % (2 * step) != 0 ) {
+            Comms::send(rank - step, 0, profile);
+            return;
+        }
+        if ( rank + step < world ) {
+            CheckpointProfile other;
+            Comms::recv(rank + step, 0, other);
+            profile.merge(other);
+        }
+    }
+#else
+    (void)profile;
+#endif
+}
+
+void
+writeCheckpointProfile(const std::string& profile_filename, const CheckpointProfile& profile, uint64_t partitions)
+{
+    json::ordered_json obj = json::ordered_json::object();
+
+    auto add = [](json::ordered_json& node, const std::map<std::string, CheckpointProfile::Entry>& entries) {
+        node = json::ordered_json::object();
+        for ( auto& [name, entry] : entries ) {
+            node[name] = { { "count", entry.count }, { "bytes", entry.bytes }, { "time", entry.time } };
+        }
+    };
+    obj["partitions"] = partitions;
+    add(obj["sections"], profile.sections);
+    add(obj["component_types"], profile.types);
+
+    const auto&         t        = profile.tracking;
+    json::ordered_json& tracking = obj["pointer_tracking"];
+    tracking["tables"]            = t.tables;
+    tracking["pointers"]          = t.pointers;
+    tracking["max_pointers"]      = t.max_pointers;
+    tracking["capacity"]          = t.capacity;
+    tracking["lookups"]           = t.lookups;
+    tracking["hits"]              = t.hits;
+    tracking["probes"]            = t.probes;
+    tracking["shared_ptr_owners"] = t.shared_ptr_owners;
+    tracking["hit_rate"]          = t.lookups ? double(t.hits) / t.lookups : 0.0;
+    tracking["probes_per_lookup"] = t.lookups ? double(t.probes) / t.lookups : 0.0;
+
+    std::string out = obj.dump(2) + "\n";
+    writeFile(profile_filename, out.data(), out.size());
+}
+
+AsyncWriter::~AsyncWriter()
+{
+    shutdown();
+}
+
+void
+AsyncWriter::write(const std::string& filename, std::vector<char>&& data)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if ( !thread_.joinable() ) {
+        stop_   = false;
+        thread_ = std::thread(&AsyncWriter::run, this);
+    }
+    queue_.push_back({ filename, std::move(data), false, 0 });
+    cv_.notify_all();
+}
+
+void
+AsyncWriter::write(const std::string& filename, uint64_t offset, std::vector<char>&& data)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if ( !thread_.joinable() ) {
+        stop_   = false;
+        thread_ = std::thread(&AsyncWriter::run, this);
+    }
+    queue_.push_back({ filename, std::move(data), true, offset });
+    cv_.notify_all();
+}
+
+double
+AsyncWriter::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return queue_.empty() && !busy_; });
+    // Errors are reported here rather than on the writer thread
+    if ( !failed_file_.empty() ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "ERROR: Error writing checkpoint file %s\n", failed_file_.c_str());
+    }
+    return last_write_end_;
+}
+
+void
+AsyncWriter::shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if ( !thread_.joinable() ) return;
+        stop_ = true;
+        cv_.notify_all();
+    }
+    thread_.join();
+}
+
+void
+AsyncWriter::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while ( true ) {
+        cv_.wait(lock, [this] { return !queue_.empty() || stop_; });
+        if ( queue_.empty() ) return;
+
+        auto job = std::move(queue_.front());
+        queue_.pop_front();
+        busy_ = true;
+        lock.unlock();
+
+        std::ofstream fs = Simulation::filesystem.ofstream(
+            job.filename, std::ios::out | std::ios::binary | (job.at_offset ? std::ios::in : std::ios::trunc));
+        if ( job.at_offset ) fs.seekp(job.offset);
+        fs.write(job.data.data(), job.data.size());
+        fs.close();
+        const bool failed = !fs;
+        // Free the data before marking the write done
+        std::vector<char>().swap(job.data);
+        double end = sst_get_cpu_time();
+
+        lock.lock();
+        if ( failed && failed_file_.empty() ) failed_file_ = job.filename;
+        busy_           = false;
+        last_write_end_ = end;
+        cv_.notify_all();
+    }
+}
+
 
 } // namespace Checkpointing
 
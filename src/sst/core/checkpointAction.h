@@ -21,9 +21,19 @@
 #include "sst/core/threadsafe.h"
 #include "sst/core/timeConverter.h"
 
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <fstream>
+#include <istream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace SST {
 
@@ -59,6 +69,280 @@ void removeDirectory(const std::string name);
  */
 std::string initializeCheckpointInfrastructure(Config* cfg, bool can_ckpt, int myRank);
 
+/**
+   Whether compressed checkpoint files can be written.  Compression
+   uses zlib, which is optional.
+ */
+bool compressionAvailable();
+
+/**
+   Compress the contents of a checkpoint file.  The data is split into
+   fixed size chunks that are compressed independently and followed
+   by an index of the chunks, so a reader can find a component (at the
+   offset given in the registry) without decompressing the whole file.
+
+   @param data Contents of the file
+   @return Compressed file
+ */
+std::vector<char> compressFile(const std::vector<char>& data);
+
+/**
+   Open a checkpoint file for reading.  Compressed files are
+   decompressed a chunk at a time as they are read, so seeking to a
+   component only decompresses the chunks holding it.  While a memory
+   checkpoint is set with setSource(), files are read from it instead
+   of from disk.
+
+   @param filename Name of the file
+   @return Stream for the uncompressed contents of the file.  Check
+   the stream state to see whether the open succeeded.
+ */
+std::unique_ptr<std::istream> openCheckpointFile(const std::string& filename);
+
+/**
+   Checkpoint kept in memory instead of being written to files.  The
+   interactive console can rewind the simulation to it, which restarts
+   the simulation from the files held in memory.
+ */
+struct MemoryCheckpoint
+{
+    SimTime_t                                time = 0; // Simulated time of the checkpoint
+    std::string                              registry; // Path of the registry file
+    std::map<std::string, std::vector<char>> files;    // Contents of each file by path
+    std::mutex                               lock;     // Protects files while partitions are written
+};
+
+/**
+   Set the memory checkpoint that checkpoint files are written to.
+   Must be called by a single thread while no files are being written.
+
+   @param checkpoint Checkpoint to hold the files or nullptr to write
+   files to disk
+ */
+void setCapture(MemoryCheckpoint* checkpoint);
+
+/** Whether checkpoint files are being written to memory */
+bool isCapturing();
+
+/**
+   Write checkpoint data to a file, or to the memory checkpoint being
+   captured if there is one
+
+   @param filename File to write
+   @param data Data to write
+   @param size Size of data
+   @param append Whether to append to the file instead of replacing it
+ */
+void writeFile(const std::string& filename, const char* data, size_t size, bool append = false);
+
+/**
+   Write checkpoint data into an existing file at an offset, or into
+   the memory checkpoint being captured if there is one.  Used when
+   several partitions write to the same file.
+
+   @param filename File to write
+   @param offset Offset in the file to write the data at
+   @param data Data to write
+   @param size Size of data
+ */
+void writeFileAt(const std::string& filename, uint64_t offset, const char* data, size_t size);
+
+/**
+   Read a file written with writeFile()
+
+   @param filename File to read
+   @param data Filled with the contents of the file
+ */
+void readFile(const std::string& filename, std::vector<char>& data);
+
+/**
+   Set the memory checkpoint that openCheckpointFile() reads files
+   from, used to restart the simulation from it.  Must be called by a
+   single thread while no files are being read.
+
+   @param checkpoint Checkpoint holding the files or nullptr to read
+   files from disk
+ */
+void setSource(const MemoryCheckpoint* checkpoint);
+
+/**
+   Index of where the data of each component is in a checkpoint,
+   written alongside the registry so a restart can find components
+   without parsing the registry
+ */
+struct ComponentIndex
+{
+    struct Entry
+    {
+        uint64_t id;     // Component id
+        uint64_t file;   // Index into files
+        uint64_t offset; // Offset of the component's record in the (uncompressed) file
+        uint64_t size;   // Size of the record
+    };
+
+    std::vector<std::string> files;      // Files relative to the checkpoint directory
+    std::vector<Entry>       components; // Sorted by id
+};
+
+/**
+   Append the components of a partition to the index of a checkpoint.
+   Partitions take turns appending, the same as for the registry.
+
+   @param index_filename Index file
+   @param first Whether this is the first partition, which truncates
+   the file
+   @param blob_filename File holding the partition's data
+   @param offsets Id and offset of each component in blob_filename
+   @param sizes Size of each component's record
+ */
+void appendComponentIndex(const std::string& index_filename, bool first, const std::string& blob_filename,
+    const std::vector<std::pair<ComponentId_t, uint64_t>>& offsets, const std::vector<uint64_t>& sizes);
+
+/**
+   Sort the index of a checkpoint by component id once all the
+   partitions have been appended
+ */
+void finalizeComponentIndex(const std::string& index_filename);
+
+/**
+   Read the index of a checkpoint
+
+   @return false if the file isn't a component index
+ */
+bool readComponentIndex(const std::string& index_filename, ComponentIndex& index);
+
+/**
+   Bytes and time spent serializing the parts of a checkpoint
+ */
+struct CheckpointProfile
+{
+    struct Entry
+    {
+        uint64_t count = 0;   // Number of items (checkpoints, components or TimeVortex entries)
+        uint64_t bytes = 0;   // Serialized size
+        double   time  = 0.0; // Time spent serializing in seconds
+    };
+
+    // By section: simulation, time_vortex, components, links and
+    // statistics.  Events in the TimeVortex are serialized with their
+    // links, so the time_vortex section only counts the time to
+    // collect and sort them.  The links section is not included in
+    // the components section.
+    std::map<std::string, Entry> sections;
+    // By component type.  Includes everything in the record of each
+    // component, i.e. its subcomponents and links.
+    std::map<std::string, Entry> types;
+
+    // Pointer tracking tables of the packing passes
+    struct Tracking
+    {
+        uint64_t tables            = 0; // Number of tables (one per packing pass)
+        uint64_t pointers          = 0; // Pointers tracked
+        uint64_t max_pointers      = 0; // Pointers in the largest table
+        uint64_t capacity          = 0; // Slots in the tables
+        uint64_t lookups           = 0; // Pointers looked up
+        uint64_t hits              = 0; // Lookups which found the pointer already tracked
+        uint64_t probes            = 0; // Slots examined by the lookups
+        uint64_t shared_ptr_owners = 0; // std::shared_ptr owners tracked
+    };
+    Tracking tracking;
+
+    void clear();
+    void merge(const CheckpointProfile& other);
+};
+
+/**
+   Profile of the checkpoint being written by the calling thread, or
+   nullptr if the checkpoint isn't being profiled
+ */
+CheckpointProfile* activeProfile();
+
+/** Set the profile returned by activeProfile() for the calling thread */
+void setActiveProfile(CheckpointProfile* profile);
+
+/**
+   Sum the profiles of all the ranks into the profile of rank 0.  Must
+   be called by one thread of every rank.  The ranks are combined in a
+   tree, so rank 0 receives log2(ranks) profiles.
+
+   @param profile Profile of the calling rank.  On rank 0, replaced by
+   the total of all the ranks.
+ */
+void reduceCheckpointProfile(CheckpointProfile& profile);
+
+/**
+   Write the JSON profile of a checkpoint
+
+   @param profile_filename Profile file
+   @param profile Total of the profiles of the partitions
+   @param partitions Number of partitions in the checkpoint
+ */
+void writeCheckpointProfile(const std::string& profile_filename, const CheckpointProfile& profile, uint64_t partitions);
+
+/**
+   Writes checkpoint files on a background thread so the simulation
+   can continue while the data is written.  Files are written in the
+   order they are queued.  The thread is started on first use.
+ */
+class AsyncWriter
+{
+public:
+    AsyncWriter() = default;
+    ~AsyncWriter();
+
+    /**
+       Queue data to be written to a file.  Can be called from any thread.
+
+       @param filename Name of the file to write
+       @param data Contents of the file.  Ownership is taken by the writer.
+     */
+    void write(const std::string& filename, std::vector<char>&& data);
+
+    /**
+       Queue data to be written into an existing file at an offset.
+       Can be called from any thread.
+
+       @param filename Name of the file to write
+       @param offset Offset in the file to write the data at
+       @param data Data to write.  Ownership is taken by the writer.
+     */
+    void write(const std::string& filename, uint64_t offset, std::vector<char>&& data);
+
+    /**
+       Wait for all queued files to be written.  Exits with a fatal
+       error if any file could not be written.
+
+       @return Time the last file finished writing, or 0.0 if no file
+       has been written
+     */
+    double wait();
+
+    /**
+       Wait for all queued files to be written and stop the writer thread
+     */
+    void shutdown();
+
+private:
+    struct Job
+    {
+        std::string       filename;
+        std::vector<char> data;
+        bool              at_offset; // Whether data is written into the existing file instead of replacing it
+        uint64_t          offset;
+    };
+
+    void run();
+
+    std::mutex              mutex_;
+    std::condition_variable cv_;
+    std::deque<Job>         queue_;
+    std::thread             thread_;
+    bool                    busy_           = false;
+    bool                    stop_           = false;
+    double                  last_write_end_ = 0.0;
+    std::string             failed_file_; // First file that could not be written
+};
+
 } // namespace Checkpointing
 
 /**
@@ -100,8 +384,40 @@ public:
     /** Return next checkpoint time */
     SimTime_t getNextCheckpointSimTime();
 
-    static Core::ThreadSafe::Barrier barrier;
-    static uint32_t                  checkpoint_id;
+    /**
+       Wait for any checkpoint files still being written in the
+       background and add their write time to the totals, then mark
+       the checkpoint complete by renaming its registry and index.
+       Must be called by thread 0 of every rank while the other
+       threads are not checkpointing.
+     */
+    static void finishWrites();
+
+    /** Time spent creating checkpoints on this rank */
+    struct CheckpointTimes
+    {
+        uint64_t count     = 0;
+        double   stall     = 0.0; // Time the simulation was stopped for checkpoints
+        double   write     = 0.0; // Time until checkpoints were completely written
+        double   max_stall = 0.0;
+        double   max_write = 0.0;
+    };
+
+    static Core::ThreadSafe::Barrier  barrier;
+    static uint32_t                   checkpoint_id;
+    static Checkpointing::AsyncWriter writer;
+    static CheckpointTimes            times;
+
+    // Totals of the profiles of the checkpoints written by this rank
+    static Checkpointing::CheckpointProfile profile;
+
+    // Checkpoints kept in memory, oldest first
+    static std::deque<std::unique_ptr<Checkpointing::MemoryCheckpoint>> memory_checkpoints;
+
+    // Checkpoint kept in memory that the simulation is being rewound
+    // to from the interactive console, if any.  The run loop ends and
+    // the simulation is restarted from it.
+    static Checkpointing::MemoryCheckpoint* rewind_checkpoint;
 
     NotSerializable(SST::CheckpointAction);
 
@@ -111,6 +427,17 @@ private:
 
     void createCheckpoint(Simulation* sim); // The actual checkpoint operation
 
+    /**
+       Write this partition's checkpoint data into a file shared by
+       all the threads of the ranks in its aggregation group.  Each
+       partition writes its own data at its offset in the file, except
+       for compressed files, which are compressed as a whole by the
+       first rank in the group.
+
+       @return Offset of the partition's data in the file
+     */
+    uint64_t writeAggregated(Simulation* sim, const std::string& filename);
+
     RankInfo      rank_;          // RankInfo for this thread/rank
     TimeConverter period_;        // Simulation time interval for scheduling or nullptr if not set
     double        last_cpu_time_; // Last time a checkpoint was triggered
@@ -118,6 +445,34 @@ private:
     SimTime_t     next_sim_time_; // Next simulationt ime a checkpoint should trigger at or 0 if not applicable
     std::string   dir_format_;    // Format string for checkpoint directory names
     std::string   file_format_;   // Format string for checkpoint file names
+    bool          async_;         // Whether checkpoint files are written in the background
+    bool          incremental_;   // Whether unchanged components refer to earlier checkpoints
+    uint32_t      aggregate_;     // Number of ranks sharing a checkpoint file or 0 for a file per partition
+    bool          compress_;      // Whether checkpoint files are compressed
+    uint32_t      memory_;        // Number of checkpoints kept in memory or 0 to write files
+    bool          profile_;       // Whether the size and time of each part of a checkpoint are recorded
+
+    // Profile of the checkpoint being written by this thread
+    Checkpointing::CheckpointProfile checkpoint_profile_;
+
+    // Total of the profiles of the threads of this rank for the
+    // checkpoint being written
+    static Checkpointing::CheckpointProfile rank_profile_;
+
+    // Start time and stall time of the last checkpoint if its files
+    // may still be being written in the background, otherwise
+    // pending_start_ is negative
+    static double pending_start_;
+    static double pending_stall_;
+
+    // Registry and index files of the checkpoint being written in the
+    // background, which are renamed from <name>.pending when the
+    // data files are written (rank 0 only)
+    static std::vector<std::string> pending_files_;
+
+    // Data of each thread's partition when writing shared files
+    static std::vector<std::vector<char>> aggregate_images_;
+    static uint64_t                       aggregate_rank_base_;
 };
 
 } // namespace SST
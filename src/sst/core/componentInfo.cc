@@ -13,6 +13,8 @@
 
 #include "sst/core/componentInfo.h"
 
+#include "sst/core/checkpointAction.h"
+#include "sst/core/cputimer.h"
 #include "sst/core/linkMap.h"
 #include "sst/core/model/configGraph.h"
 #include "sst/core/serialization/serialize.h"
@@ -196,7 +198,24 @@ void
 ComponentInfo::serialize_comp(SST::Core::Serialization::serializer& ser)
 {
     SST_SER(component);
-    SST_SER(link_map);
+
+    // Links are profiled separately from their component
+    Checkpointing::CheckpointProfile* profile = Checkpointing::activeProfile();
+    if ( profile ) {
+        double start = sst_get_cpu_time();
+        size_t bytes = ser.size();
+        SST_SER(link_map);
+        auto& section = profile->sections["links"];
+        if ( ser.mode() == SST::Core::Serialization::serializer::PACK ) {
+            if ( link_map != nullptr ) section.count += link_map->getLinkMap().size();
+            section.bytes += ser.size() - bytes;
+        }
+        section.time += sst_get_cpu_time() - start;
+    }
+    else {
+        SST_SER(link_map);
+    }
+
     for ( auto it = subComponents.begin(); it != subComponents.end(); ++it ) {
         it->second.serialize_comp(ser);
     }
@@ -19,6 +19,7 @@
 #include "sst/core/warnmacros.h"
 
 #include <cerrno>
+#include <cmath>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
@@ -440,6 +441,14 @@ Config::insertOptions()
         exit_after_, true, false, false);
     DEF_ARG("partitioner", 0, "PARTITIONER", "Select the partitioner to be used. <lib.partitionerName>", partitioner_,
         true, false, false);
+    DEF_ARG("partitioner-lookahead", 0, "TIME",
+        "Links with a latency below this value will not be cut by partitioners that support it (sst.lookahead). If not "
+        "specified, the partitioner picks the largest lookahead that still allows the load to be balanced",
+        partitioner_lookahead_, true, false, false);
+    DEF_ARG("partitioner-imbalance", 0, "RATIO",
+        "Allowed load imbalance, as the ratio of the maximum to the average load of a rank/thread, for graph "
+        "partitioners that support it (sst.multilevel, sst.lookahead). Must be at least 1.0 [default: 1.03]",
+        partitioner_imbalance_, true, false, false);
     DEF_ARG("heartbeat-period", 0, "PERIOD",
         "Set time for heartbeats to be published (these are approximate timings measured in simulation time, published "
         "by the core, to update on progress)",
@@ -466,10 +475,19 @@ Config::insertOptions()
         true, false, true);
     DEF_ARG("output-json", 0, "FILE", "File to write SST configuration graph (in JSON format)", output_json_, true,
         false, true);
+    DEF_FLAG("output-json-index", 0,
+        "Also write an index of the records in the JSON configuration graph to <FILE>.idx.  When the file is loaded "
+        "in parallel with --parallel-load=SINGLE, each rank uses the index to parse only its own part of the file.",
+        output_json_index_, true, false, true);
+    DEF_ARG("output-binary-graph", 0, "FILE",
+        "File to write SST configuration graph (in binary format).  The file must have a .sstgraph extension and can "
+        "be loaded again without rerunning the model.  The partition is reused if it is loaded with the same number "
+        "of ranks and threads.",
+        output_binary_graph_, true, false, true);
 #ifdef SST_CONFIG_HAVE_MPI
     DEF_FLAG_OPTVAL("parallel-output", 0,
         "Enable parallel output of configuration information.  This option is ignored for single rank jobs.  Must also "
-        "specify an output type (--output-config and/or --output-json).  Note: this will also cause partition info to "
+        "specify an output type (--output-config, --output-json and/or --output-binary-graph).  Note: this will also cause partition info to "
         "be output if set to true.",
         parallel_output_, true, false, true);
 #endif
@@ -502,6 +520,10 @@ Config::insertOptions()
         "timeVortex", 0, "MODULE", "Select TimeVortex implementation <lib.timevortex>", timeVortex_, true, true, false);
     DEF_FLAG_OPTVAL("interthread-links", 0, "[EXPERIMENTAL] Set whether or not interthread links should be used",
         interthread_links_, true);
+    DEF_FLAG_OPTVAL("parallel-construction", 0,
+        "[EXPERIMENTAL] Set whether the components of different threads are constructed concurrently.  Requires "
+        "element constructors to be thread safe.",
+        parallel_construction_, true);
 #ifdef USE_MEMPOOL
     DEF_FLAG_OPTVAL("cache-align-mempools", 0, "[EXPERIMENTAL] Set whether mempool allocations are cache aligned",
         cache_align_mempools_, true, true, true);
@@ -526,6 +548,14 @@ Config::insertOptions()
         "filename including a '.txt' (text) or '.json' (JSON) extension. To specify stdout and a filename, list both "
         "separated by a comma such as 'stdout,output.json']",
         profiling_output_, true, false, false);
+    DEF_ARG("output-partition-weights", 0, "FILE",
+        "Measure the time spent in each component's handlers and the number of events received on each port, and "
+        "write them to FILE at the end of the run for use with --partition-weights",
+        output_partition_weights_, true, false, false);
+    DEF_ARG("partition-weights", 0, "FILE",
+        "Use component costs and link traffic from a file written by --output-partition-weights to set the component "
+        "and link weights used by the partitioner. Also applies to repartitioned restarts.",
+        partition_weights_, true, false, false);
 
     /* Advanced Features - Debug */
     DEF_SECTION_HEADING("Advanced Options - Debug");
@@ -596,6 +626,38 @@ Config::insertOptions()
         "Set the format for checkpoint filenames. See extended help for format options.  Default is "
         "\"%p_%n_%t/%p_%n_%t\"",
         checkpoint_name_format_, true, false, false);
+    DEF_FLAG_OPTVAL("checkpoint-async", 0,
+        "Set whether checkpoint files are written in the background.  The simulation resumes as soon as its state "
+        "has been copied into memory, which requires enough memory to hold a copy of the checkpoint.",
+        checkpoint_async_, true, false, false);
+    DEF_FLAG_OPTVAL("checkpoint-incremental", 0,
+        "Set whether checkpoints only write the components whose state changed since the previous checkpoint.  "
+        "Unchanged components refer to their data in an earlier checkpoint, so restarting requires the earlier "
+        "checkpoint directories to be kept alongside.",
+        checkpoint_incremental_, true, false, false);
+
+    DEF_FLAG_OPTVAL("checkpoint-compress", 0,
+        "Set whether checkpoint files are compressed.  Files are compressed in independent chunks, followed by an "
+        "index of the chunks and components, so restarts only decompress the data they need.  Requires SST to be "
+        "built with zlib.",
+        checkpoint_compress_, true, false, false);
+    DEF_ARG("checkpoint-aggregate", 0, "NUM",
+        "Write the checkpoint data of each group of NUM ranks, including all of their threads, to a single shared "
+        "file instead of one file per partition.  This reduces the number of files created on parallel filesystems.  "
+        "Each partition writes its data at its own offset in the file, except that compressed files are collected "
+        "and compressed by the first rank of each group.  0 writes one file per partition [default: 0]",
+        checkpoint_aggregate_, true, false, false);
+    DEF_ARG("checkpoint-memory", 0, "NUM",
+        "Keep the NUM most recent checkpoints in memory instead of writing them to files.  The interactive console can "
+        "rewind the simulation to any of them (see the 'snapshots' and 'rewind' console commands), which restarts the "
+        "simulation in place from that checkpoint.  Only supported for single rank runs.  0 writes checkpoints to "
+        "files [default: 0]",
+        checkpoint_memory_, true, false, false);
+    DEF_FLAG_OPTVAL("checkpoint-profile", 0,
+        "Set whether the bytes and time spent serializing each checkpoint, broken down by component type and by "
+        "section (TimeVortex, links, statistics), are written to a JSON file next to the checkpoint registry.  The "
+        "totals over all checkpoints on rank 0 are added to the timing information (see --print-timing-info).",
+        checkpoint_profile_, true, false, false);
 
     enableDashDashSupport(std::bind(&OptionDefinition::parse, &model_options_, _1));
     addPositionalCallback(std::bind(&Config::positionalCallback, this, _1, _2));
@@ -672,6 +734,32 @@ Config::canInitiateInteractive()
     return false;
 }
 
+// Check that the imbalance is a finite ratio of at least 1.0
+int
+Config::parse_partitioner_imbalance(double& var, std::string arg)
+{
+    double value;
+    try {
+        value = SST::Core::from_string<double>(arg);
+    }
+    catch ( const std::exception& e ) {
+        fprintf(stderr, "Error parsing option: Argument passed to --partitioner-imbalance is not a number: %s\n",
+            arg.c_str());
+        return -1;
+    }
+
+    // NaN fails this comparison too
+    if ( !(value >= 1.0) || std::isinf(value) ) {
+        fprintf(stderr,
+            "Error parsing option: Argument passed to --partitioner-imbalance must be a finite ratio of maximum to "
+            "average load of at least 1.0 (e.g. 1.03 for 3%% imbalance). Argument = [%s]\n",
+            arg.c_str());
+        return -1;
+    }
+    var = value;
+    return 0;
+}
+
 // Set the prefix for checkpoint files
 int
 Config::parse_checkpoint_name_format(std::string& var, std::string arg)
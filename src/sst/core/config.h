@@ -202,6 +202,22 @@ private:
     */
     SST_CONFIG_DECLARE_OPTION(std::string, partitioner, "sst.linear", &StandardConfigParsers::element_name);
 
+    /**
+       Minimum link latency that graph partitioners should avoid
+       cutting (empty string means the partitioner chooses)
+    */
+    SST_CONFIG_DECLARE_OPTION(std::string, partitioner_lookahead, "",
+        std::bind(&StandardConfigParsers::check_unitalgebra_store_string, "s", std::placeholders::_1,
+            std::placeholders::_2));
+
+    /**
+       Allowed load imbalance for graph partitioners, as the ratio of
+       the maximum to the average load of a rank/thread
+    */
+    static int parse_partitioner_imbalance(double& var, std::string arg);
+
+    SST_CONFIG_DECLARE_OPTION(double, partitioner_imbalance, 1.03, &Config::parse_partitioner_imbalance);
+
     /**
        Wall-clock period at which to print out a "heartbeat" message
     */
@@ -240,6 +256,19 @@ private:
     */
     SST_CONFIG_DECLARE_OPTION(std::string, output_json, "", &StandardConfigParsers::from_string<std::string>);
 
+    /**
+       If true, also write a sidecar index (<file>.idx) next to the
+       JSON config graph output, used to load the file in parallel
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, output_json_index, false, &StandardConfigParsers::flag_set_true);
+
+    /**
+       File to output binary config graph to (empty string means no
+       output)
+    */
+    SST_CONFIG_DECLARE_OPTION(
+        std::string, output_binary_graph, "", &StandardConfigParsers::from_string<std::string>);
+
     /**
        If true, and a config graph output option is specified, write
        each ranks graph separately
@@ -390,6 +419,12 @@ private:
     */
     SST_CONFIG_DECLARE_OPTION(bool, interthread_links, false, &StandardConfigParsers::flag_default_true);
 
+    /**
+       Run component constructors on different threads concurrently
+       instead of serializing them on the Factory lock
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, parallel_construction, false, &StandardConfigParsers::flag_default_true);
+
 
 #ifdef USE_MEMPOOL
     /**
@@ -446,6 +481,19 @@ private:
     SST_CONFIG_DECLARE_OPTION(
         std::string, profiling_output, "stdout", &StandardConfigParsers::from_string<std::string>);
 
+    /**
+       File to write measured component costs and link traffic to at
+       the end of the run (empty string means no output)
+     */
+    SST_CONFIG_DECLARE_OPTION(
+        std::string, output_partition_weights, "", &StandardConfigParsers::from_string<std::string>);
+
+    /**
+       File of measured component costs and link traffic to use as
+       partitioning weights (empty string means don't use)
+     */
+    SST_CONFIG_DECLARE_OPTION(std::string, partition_weights, "", &StandardConfigParsers::from_string<std::string>);
+
 
     /**** Advanced options - Debug ****/
 
@@ -615,6 +663,43 @@ private:
         std::bind(&Config::parse_checkpoint_name_format, std::placeholders::_1, std::placeholders::_2),
         &Config::ext_help_checkpoint_format);
 
+    /**
+       Whether checkpoint files are written by a background thread
+       after the state has been captured in memory, rather than before
+       the simulation resumes
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, checkpoint_async, false, &StandardConfigParsers::flag_default_true);
+
+    /**
+       Whether checkpoints only write the components whose state
+       changed since the previous checkpoint
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, checkpoint_incremental, false, &StandardConfigParsers::flag_default_true);
+
+    /**
+       Whether checkpoint files are written in a block compressed
+       format
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, checkpoint_compress, false, &StandardConfigParsers::flag_default_true);
+
+    /**
+       Number of ranks whose partitions are written to a single shared
+       checkpoint file.  0 writes a file per partition.
+    */
+    SST_CONFIG_DECLARE_OPTION(uint32_t, checkpoint_aggregate, 0, &StandardConfigParsers::from_string<uint32_t>);
+
+    /**
+       Number of checkpoints kept in memory instead of being written
+       to files.  0 writes checkpoints to files.
+    */
+    SST_CONFIG_DECLARE_OPTION(uint32_t, checkpoint_memory, 0, &StandardConfigParsers::from_string<uint32_t>);
+
+    /**
+       Whether a breakdown of checkpoint size and time by component
+       type and section is written next to each checkpoint registry
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, checkpoint_profile, false, &StandardConfigParsers::flag_default_true);
+
 public:
 
     /** Get whether or not any of the checkpoint options were turned on */
@@ -32,6 +32,7 @@ namespace SST::Impl {
 INSTANTIATE_SERIALIZE_DATA(bool);
 INSTANTIATE_SERIALIZE_DATA(int32_t);
 INSTANTIATE_SERIALIZE_DATA(uint32_t);
+INSTANTIATE_SERIALIZE_DATA(double);
 INSTANTIATE_SERIALIZE_DATA(std::string);
 INSTANTIATE_SERIALIZE_DATA(SST::SimulationRunMode);
 
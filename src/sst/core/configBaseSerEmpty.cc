@@ -28,6 +28,7 @@ namespace SST::Impl {
 
 INSTANTIATE_SERIALIZE_DATA(bool);
 INSTANTIATE_SERIALIZE_DATA(int);
+INSTANTIATE_SERIALIZE_DATA(double);
 INSTANTIATE_SERIALIZE_DATA(std::string);
 
 
@@ -21,6 +21,7 @@
 #include <cstring>
 #include <exception>
 #include <map>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -120,6 +121,19 @@ protected:
      */
     std::vector<std::string> getParamsLocalKeys(const Params& params) const { return params.getLocalKeys(); }
 
+    /**
+     * Get the names of all the parameter keys
+     *
+     * @return returns a vector of the key names, indexed by the key
+     * ids used in the Params objects
+     *
+     */
+    static std::vector<std::string> getParamKeyNames()
+    {
+        std::scoped_lock lock(Params::keyLock);
+        return Params::keyMapReverse;
+    }
+
 
     /**
      * Get a vector of the shared param sets this Params object is
@@ -23,7 +23,9 @@
 #include <cstdio>
 #include <cstring>
 #include <dirent.h>
+#include <fstream>
 #include <ostream>
+#include <sstream>
 #include <vector>
 
 #ifdef HAVE_DLFCN_H
@@ -101,6 +103,48 @@ checkForValidSlotNames(const std::string& libname)
     }
 }
 
+/**
+   Returns the modification time of a file or directory in ns, or -1
+   if it does not exist
+ */
+int64_t
+getModTime(const std::string& path)
+{
+    struct stat sb;
+    if ( 0 != stat(path.c_str(), &sb) ) return -1;
+#ifdef SST_COMPILE_MACOSX
+    return (int64_t)sb.st_mtimespec.tv_sec * 1000000000 + sb.st_mtimespec.tv_nsec;
+#else
+    return (int64_t)sb.st_mtim.tv_sec * 1000000000 + sb.st_mtim.tv_nsec;
+#endif
+}
+
+/**
+   Returns the directory with any trailing '/' removed, so the same
+   directory always has the same key in the index
+ */
+std::string
+indexKey(const std::string& dir)
+{
+    std::string key(dir);
+    while ( key.size() > 1 && key.back() == '/' )
+        key.pop_back();
+    return key;
+}
+
+/**
+   Returns the name of the element library in the file (file name
+   without the "lib" prefix and the extension), or an empty string if
+   the file name isn't that of a potential element library
+ */
+std::string
+getLibraryName(const std::string& file_name)
+{
+    if ( file_name.compare(0, 3, "lib") != 0 ) return "";
+    size_t ext = file_name.rfind('.');
+    if ( ext == std::string::npos || ext < 3 ) return "";
+    return file_name.substr(3, ext - 3);
+}
 
 } // namespace
 
@@ -135,6 +179,16 @@ ElemLoader::ElemLoader(const std::string& searchPaths) :
     if ( (nullptr != bind_env) && ((!strcmp(bind_env, "now")) || (!strcmp(bind_env, "NOW"))) ) {
         bindPolicy = RTLD_NOW | RTLD_GLOBAL;
     }
+
+    // Setting the variable to an empty string turns off the index
+    const char* index_env = getenv("SST_CORE_ELEMLIB_INDEX");
+    if ( nullptr != index_env ) {
+        indexFile = index_env;
+    }
+    else {
+        const char* home_env = getenv("HOME");
+        if ( nullptr != home_env ) indexFile = std::string(home_env) + "/.sst/elemlib_index";
+    }
 }
 
 void
@@ -162,22 +216,36 @@ ElemLoader::loadLibrary(const std::string& elemlib, std::ostream& err_os)
             printf("SST-DL: Searching: %s\n", next_path.c_str());
         }
 
+        // If the index is current for this directory, only files
+        // the index lists need to be opened
+        const IndexedDirectory* indexed = findIndexedDirectory(next_path);
+
+        std::string lib_file = "lib" + elemlib + ".so";
         if ( next_path.back() == '/' ) {
-            snprintf(full_path, PATH_MAX, "%slib%s.so", next_path.c_str(), elemlib.c_str());
+            snprintf(full_path, PATH_MAX, "%s%s", next_path.c_str(), lib_file.c_str());
         }
         else {
-            snprintf(full_path, PATH_MAX, "%s/lib%s.so", next_path.c_str(), elemlib.c_str());
+            snprintf(full_path, PATH_MAX, "%s/%s", next_path.c_str(), lib_file.c_str());
         }
 
-        if ( verbose ) {
-            printf("SST-DL: Attempting to load %s\n", full_path);
+        bool  skip   = indexed && indexed->libraries.count(lib_file) == 0;
+        void* handle = nullptr;
+        if ( skip ) {
+            if ( verbose ) {
+                printf("SST-DL: %s not in element library index, skipping\n", full_path);
+            }
         }
+        else {
+            if ( verbose ) {
+                printf("SST-DL: Attempting to load %s\n", full_path);
+            }
 
-        // use a global bind policy read from environment, default to RTLD_LAZY
-        void* handle = dlopen(full_path, bindPolicy);
+            // use a global bind policy read from environment, default to RTLD_LAZY
+            handle = dlopen(full_path, bindPolicy);
+        }
 
 #ifdef SST_COMPILE_MACOSX
-        if ( nullptr == handle ) {
+        if ( nullptr == handle && !skip ) {
             if ( verbose ) {
                 printf("SST-DL: Loading failed for %s, error: %s\n", full_path, dlerror());
             }
@@ -200,22 +268,36 @@ ElemLoader::loadLibrary(const std::string& elemlib, std::ostream& err_os)
         // this implies ordering of .so before .dylib in priority.
 
         if ( nullptr == handle ) {
+            lib_file = "lib" + elemlib + ".dylib";
             if ( next_path.back() == '/' ) {
-                snprintf(full_path, PATH_MAX, "%slib%s.dylib", next_path.c_str(), elemlib.c_str());
+                snprintf(full_path, PATH_MAX, "%s%s", next_path.c_str(), lib_file.c_str());
             }
             else {
-                snprintf(full_path, PATH_MAX, "%s/lib%s.dylib", next_path.c_str(), elemlib.c_str());
+                snprintf(full_path, PATH_MAX, "%s/%s", next_path.c_str(), lib_file.c_str());
             }
 
-            if ( verbose ) {
-                printf("SST-DL: Attempting to load %s\n", full_path);
+            skip = indexed && indexed->libraries.count(lib_file) == 0;
+            if ( skip ) {
+                if ( verbose ) {
+                    printf("SST-DL: %s not in element library index, skipping\n", full_path);
+                }
             }
+            else {
+                if ( verbose ) {
+                    printf("SST-DL: Attempting to load %s\n", full_path);
+                }
 
-            // use a global bind policy read from environment, default to RTLD_LAZY
-            handle = dlopen(full_path, bindPolicy);
+                // use a global bind policy read from environment, default to RTLD_LAZY
+                handle = dlopen(full_path, bindPolicy);
+            }
         }
 #endif
 
+        if ( nullptr == handle && skip ) {
+            // File isn't there, so there is no error to record
+            continue;
+        }
+
         if ( nullptr == handle ) {
             if ( verbose ) {
                 printf("SST-DL: Loading failed, error: %s\n", dlerror());
@@ -295,6 +377,16 @@ ElemLoader::getPotentialElements(std::vector<std::string>& potential_elements)
     std::vector<std::string> paths = splitPath(searchPaths);
 
     for ( std::string const& next_path : paths ) {
+        // Use the index if it is current for this directory
+        const IndexedDirectory* indexed = findIndexedDirectory(next_path);
+        if ( indexed ) {
+            for ( auto& file_name : indexed->libraries ) {
+                std::string name = getLibraryName(file_name);
+                if ( !name.empty() ) potential_elements.push_back(name);
+            }
+            continue;
+        }
+
         DIR* current_dir = opendir(next_path.c_str());
 
         if ( current_dir ) {
@@ -329,4 +421,128 @@ ElemLoader::getPotentialElements(std::vector<std::string>& potential_elements)
     potential_elements.push_back("sst");
 }
 
+void
+ElemLoader::readIndex()
+{
+    if ( indexRead ) return;
+    indexRead = true;
+    if ( indexFile.empty() ) return;
+
+    std::ifstream in(indexFile);
+    if ( !in ) return;
+
+    // Each line is a tab separated record.  A "dir" record starts a
+    // directory and is followed by a "lib" record for each library
+    // file in it:
+    //   dir <path> <mtime>
+    //   lib <file name>
+    IndexedDirectory* dir = nullptr;
+    std::string       line;
+    while ( std::getline(in, line) ) {
+        if ( line.empty() || line[0] == '#' ) continue;
+
+        std::vector<std::string> fields;
+        std::stringstream        line_stream(line);
+        std::string              field;
+        while ( std::getline(line_stream, field, '\t') ) {
+            fields.push_back(field);
+        }
+
+        if ( fields[0] == "dir" && fields.size() == 3 ) {
+            dir        = &index[fields[1]];
+            dir->mtime = strtoll(fields[2].c_str(), nullptr, 10);
+        }
+        else if ( fields[0] == "lib" && fields.size() == 2 && dir ) {
+            dir->libraries.insert(fields[1]);
+        }
+    }
+}
+
+const ElemLoader::IndexedDirectory*
+ElemLoader::findIndexedDirectory(const std::string& dir)
+{
+    readIndex();
+
+    std::string key = indexKey(dir);
+    auto        it  = index.find(key);
+    if ( it == index.end() ) return nullptr;
+
+    // Adding, removing or renaming a library changes the modification
+    // time of the directory, so the directory entry is current if its
+    // modification time hasn't changed
+    IndexedDirectory& entry = it->second;
+    if ( !entry.checked ) {
+        entry.checked = true;
+        entry.current = getModTime(key) == entry.mtime;
+        if ( verbose && !entry.current ) {
+            printf("SST-DL: Element library index is out of date for %s\n", key.c_str());
+        }
+    }
+    return entry.current ? &entry : nullptr;
+}
+
+void
+ElemLoader::updateIndex()
+{
+    if ( indexFile.empty() ) return;
+    readIndex();
+
+    std::vector<std::string> paths = splitPath(searchPaths);
+    for ( std::string const& next_path : paths ) {
+        std::string key = indexKey(next_path);
+
+        // Get the modification time before reading the directory, so
+        // a change made while reading it marks the entry out of date
+        int64_t mtime       = getModTime(key);
+        DIR*    current_dir = mtime < 0 ? nullptr : opendir(key.c_str());
+        if ( !current_dir ) {
+            index.erase(key);
+            continue;
+        }
+
+        IndexedDirectory entry;
+        entry.mtime   = mtime;
+        entry.checked = true;
+        entry.current = true;
+
+        struct dirent* dir_file;
+        while ( (dir_file = readdir(current_dir)) != nullptr ) {
+            std::string file_name(dir_file->d_name);
+            if ( !getLibraryName(file_name).empty() ) entry.libraries.insert(file_name);
+        }
+        closedir(current_dir);
+
+        index[key] = std::move(entry);
+    }
+
+    // Write to a temporary file and rename it, so processes reading
+    // the index never see a partially written file
+    size_t dir_end = indexFile.rfind('/');
+    if ( dir_end != std::string::npos && dir_end > 0 ) {
+        mkdir(indexFile.substr(0, dir_end).c_str(), 0755);
+    }
+
+    std::string tmp_file = indexFile + ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream out(tmp_file);
+        if ( !out ) return;
+
+        out << "# SST element library index, written by sst-info\n";
+        for ( auto& [dir, entry] : index ) {
+            out << "dir\t" << dir << "\t" << entry.mtime << "\n";
+            for ( auto& file_name : entry.libraries ) {
+                out << "lib\t" << file_name << "\n";
+            }
+        }
+
+        if ( !out ) {
+            out.close();
+            unlink(tmp_file.c_str());
+            return;
+        }
+    }
+
+    if ( 0 != rename(tmp_file.c_str(), indexFile.c_str()) ) unlink(tmp_file.c_str());
+}
+
 } // namespace SST
@@ -12,7 +12,10 @@
 #ifndef SST_CORE_ELEMLOADER_H
 #define SST_CORE_ELEMLOADER_H
 
+#include <cstdint>
+#include <map>
 #include <ostream>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -49,10 +52,48 @@ public:
      */
     void getPotentialElements(std::vector<std::string>& potElems);
 
+    /**
+     * Rescan the directories in the search paths and write the
+     * element library files in them to the element library index.
+     * Entries for directories not in the search paths are kept.
+     * Errors writing the index are ignored, since the index is only
+     * used to speed up loading.  Called by sst-info when asked to
+     * (--write-elemlib-index).
+     */
+    void updateIndex();
+
 private:
+    /** A directory of the index */
+    struct IndexedDirectory
+    {
+        int64_t               mtime = 0;
+        std::set<std::string> libraries; // Names of the element library files in the directory
+        // Whether the entry has been checked against the filesystem
+        // and whether it was still current
+        bool                  checked = false;
+        bool                  current = false;
+    };
+
+    /**
+     * Reads the index file, if it has not already been read
+     */
+    void readIndex();
+
+    /**
+     * Returns the index entry for a directory if it is still current,
+     * otherwise nullptr.  Reads the index if needed.
+     */
+    const IndexedDirectory* findIndexedDirectory(const std::string& dir);
+
     std::string searchPaths;
     bool        verbose;
     int         bindPolicy;
+
+    // Element library index, read on first use.  Maps each directory
+    // to what was found there when the index was built.
+    std::string                             indexFile;
+    bool                                    indexRead = false;
+    std::map<std::string, IndexedDirectory> index;
 };
 
 } // namespace SST
@@ -50,6 +50,8 @@ namespace SST {
 Factory* Factory::instance = nullptr;
 Output   Factory::out;
 
+thread_local std::string Factory::loadingComponentType;
+
 Factory*
 Factory::createFactory(const std::string& searchPaths)
 {
@@ -222,7 +224,7 @@ Factory::CreateComponent(ComponentId_t id, const std::string& type, Params& para
     std::stringstream sstr;
     requireLibrary(elemlib, sstr);
 
-    std::scoped_lock lock(factoryMutex);
+    std::unique_lock lock(factoryMutex);
     // Check to see if library is loaded into new
     // ElementLibraryDatabase
 
@@ -234,6 +236,7 @@ Factory::CreateComponent(ComponentId_t id, const std::string& type, Params& para
             if ( compLib ) {
                 auto* fact = compLib->getBuilder(elem);
                 if ( fact ) {
+                    if ( parallel_construction ) lock.unlock();
                     loadingComponentType = type;
                     params.pushAllowedKeys(compInfo->getParamNames());
                     Component* ret = fact->create(id, params);
@@ -78,6 +78,17 @@ public:
      */
     const std::vector<std::string>& getParamNames(const std::string& type);
 
+    /**
+       Controls whether element constructors run while holding the
+       Factory lock.  By default they do, which serializes the
+       construction of components across threads.  When enabled, the
+       lock is only held while looking up the element, so the threads
+       of a rank can construct their components concurrently.
+
+       @param enable True to run constructors outside the lock
+     */
+    void setParallelConstruction(bool enable) { parallel_construction = enable; }
+
     /** Attempt to create a new Component instantiation
      * @param id - The unique ID of the component instantiation
      * @param componentname - The fully qualified elementlibname.componentname type of component
@@ -172,7 +183,7 @@ public:
 
         std::stringstream err_os;
         requireLibrary(elemlib, err_os);
-        std::lock_guard<std::recursive_mutex> lock(factoryMutex);
+        std::unique_lock<std::recursive_mutex> lock(factoryMutex);
 
         auto* lib = ELI::InfoDatabase::getLibrary<Base>(elemlib);
         if ( lib ) {
@@ -182,6 +193,7 @@ public:
                 if ( builderLib ) {
                     auto* fact = builderLib->getBuilder(elem);
                     if ( fact ) {
+                        if ( parallel_construction ) lock.unlock();
                         Base* ret = fact->create(std::forward<CtorArgs>(args)...);
                         return ret;
                     }
@@ -217,7 +229,7 @@ public:
 
         std::stringstream err_os;
         requireLibrary(elemlib, err_os);
-        std::lock_guard<std::recursive_mutex> lock(factoryMutex);
+        std::unique_lock<std::recursive_mutex> lock(factoryMutex);
 
         auto* lib = ELI::InfoDatabase::getLibrary<Base>(elemlib);
         if ( lib ) {
@@ -228,6 +240,7 @@ public:
                 if ( builderLib ) {
                     auto* fact = builderLib->getBuilder(elem);
                     if ( fact ) {
+                        if ( parallel_construction ) lock.unlock();
                         params.pushAllowedKeys(info->getParamNames());
                         Base* ret = fact->create(std::forward<CtorArgs>(args)...);
                         params.popAllowedKeys();
@@ -352,7 +365,11 @@ private:
     std::string searchPaths;
 
     ElemLoader* loader;
-    std::string loadingComponentType;
+
+    /** Type of the component being constructed by this thread */
+    static thread_local std::string loadingComponentType;
+
+    bool parallel_construction = false;
 
     static std::pair<std::string, std::string> parseLoadName(const std::string& wholename);
 
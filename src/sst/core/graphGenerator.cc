@@ -0,0 +1,165 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/graphGenerator.h"
+
+#include "sst/core/model/configComponent.h"
+#include "sst/core/model/configGraph.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace SST {
+
+SST_ELI_DEFINE_INFO_EXTERN(GraphGenerator)
+SST_ELI_DEFINE_CTOR_EXTERN(GraphGenerator)
+
+GraphGenerator::GraphGenerator(Params& params)
+{
+    latencies.push_back(params.find<std::string>("link_latency", "1ns"));
+    port_format = params.find<std::string>("port_name", "port%d");
+    if ( params.is_value_array("port_names") ) params.find_array<std::string>("port_names", port_names);
+}
+
+std::string
+GraphGenerator::formatName(const std::string& format, uint64_t num)
+{
+    std::string name(format);
+    size_t      pos = name.find("%d");
+    if ( pos == std::string::npos )
+        name += std::to_string(num);
+    else
+        name.replace(pos, 2, std::to_string(num));
+    return name;
+}
+
+std::string
+GraphGenerator::getPortName(uint32_t UNUSED(role), uint32_t port) const
+{
+    if ( port < port_names.size() ) return port_names[port];
+    return formatName(port_format, port);
+}
+
+uint64_t
+GraphGenerator::generate(ConfigGraph* graph, const std::string& name_prefix,
+    const std::map<std::string, ComponentSpec>& specs, RankInfo world_size, RankInfo my_rank, bool parallel_load)
+{
+    const uint64_t num_vertices = getNumVertices();
+
+    // Component spec for each role, nullptr for roles that aren't built
+    std::vector<const ComponentSpec*> role_spec(roles.size(), nullptr);
+    for ( size_t i = 0; i < roles.size(); ++i ) {
+        auto it = specs.find(roles[i]);
+        if ( it != specs.end() ) role_spec[i] = &it->second;
+    }
+
+    // With parallel load, the vertices are split into equal blocks in
+    // order, one block per thread
+    const uint64_t num_parts  = static_cast<uint64_t>(world_size.rank) * world_size.thread;
+    const uint64_t block_size = std::max<uint64_t>(1, (num_vertices + num_parts - 1) / num_parts);
+    auto           owner      = [&](uint64_t v) {
+        const uint64_t part = v / block_size;
+        return RankInfo(part / world_size.thread, part % world_size.thread);
+    };
+
+    uint64_t first = 0;
+    uint64_t last  = num_vertices;
+    if ( parallel_load ) {
+        first = std::min(num_vertices, static_cast<uint64_t>(my_rank.rank) * world_size.thread * block_size);
+        last  = std::min(num_vertices, first + world_size.thread * block_size);
+    }
+
+    std::string              name;
+    std::vector<double>      coords;
+    std::vector<std::string> role_prefix;
+    for ( auto& role : roles ) {
+        role_prefix.push_back(name_prefix + role);
+    }
+
+    // Adds the component for vertex v.  Components on other ranks are
+    // only needed to create the links to them, so they have no
+    // parameters.
+    auto add_vertex = [&](uint64_t v, bool local) -> ComponentId_t {
+        const Vertex         vertex = getVertex(v);
+        const ComponentSpec* spec   = role_spec[vertex.role];
+        if ( nullptr == spec ) return UNSET_COMPONENT_ID;
+
+        name = role_prefix[vertex.role];
+        name += std::to_string(vertex.index);
+        ComponentId_t    id   = graph->addComponent(name, spec->type);
+        ConfigComponent* comp = graph->findComponent(id);
+        if ( parallel_load ) comp->setRank(owner(v));
+        if ( !local ) return id;
+
+        for ( auto& param : spec->params ) {
+            comp->addParameter(param.first, param.second, true);
+        }
+        if ( !spec->shared_param_set.empty() ) comp->addSharedParamSet(spec->shared_param_set);
+        coords.clear();
+        if ( getCoordinates(v, coords) ) comp->setCoordinates(coords);
+        return id;
+    };
+
+    uint64_t                   count = 0;
+    std::vector<ComponentId_t> ids(last - first, UNSET_COMPONENT_ID);
+    for ( uint64_t v = first; v < last; ++v ) {
+        ids[v - first] = add_vertex(v, true);
+        if ( ids[v - first] != UNSET_COMPONENT_ID ) count++;
+    }
+
+    // Each link is created once, from the vertex with the lower id (or
+    // lower port for links from a vertex to itself), unless that
+    // vertex is on another rank.  Links are named after that end so
+    // that all ranks agree on the name.
+    std::unordered_map<uint64_t, ComponentId_t> remote_ids;
+    std::vector<Edge>                           edges;
+    for ( uint64_t v = first; v < last; ++v ) {
+        const ComponentId_t id = ids[v - first];
+        if ( id == UNSET_COMPONENT_ID ) continue;
+        const uint32_t role = getVertex(v).role;
+
+        edges.clear();
+        getEdges(v, edges);
+        for ( auto& edge : edges ) {
+            const uint64_t n          = edge.neighbor;
+            const bool     from_this  = v < n || (v == n && edge.port < edge.remote_port);
+            const bool     n_is_local = n >= first && n < last;
+            if ( n_is_local && !from_this ) continue;
+
+            ComponentId_t n_id;
+            if ( n_is_local ) {
+                n_id = ids[n - first];
+            }
+            else {
+                auto it = remote_ids.find(n);
+                if ( it == remote_ids.end() ) it = remote_ids.emplace(n, add_vertex(n, false)).first;
+                n_id = it->second;
+            }
+            if ( n_id == UNSET_COMPONENT_ID ) continue;
+
+            name = name_prefix;
+            name += "link";
+            name += std::to_string(from_this ? v : n);
+            name += '_';
+            name += std::to_string(from_this ? edge.port : edge.remote_port);
+
+            const char* latency = latencies[edge.latency].c_str();
+            LinkId_t    link_id = graph->createLink(name.c_str(), latency);
+            graph->addLink(id, link_id, getPortName(role, edge.port).c_str(), latency);
+            graph->addLink(n_id, link_id, getPortName(getVertex(n).role, edge.remote_port).c_str(), latency);
+        }
+    }
+    return count;
+}
+
+} // namespace SST
@@ -0,0 +1,137 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_GRAPHGENERATOR_H
+#define SST_CORE_GRAPHGENERATOR_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/params.h"
+#include "sst/core/rankInfo.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/warnmacros.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SST {
+
+class ConfigGraph;
+
+/**
+ * Base class for native topology generators.  A generator describes
+ * the vertices and edges of a topology and generate() adds the
+ * matching components and links directly to the ConfigGraph, which
+ * is much faster than building large topologies in the Python model.
+ * Generators are invoked from Python using sst.generateGraph().
+ *
+ * Each vertex has a role (for example "router" or "host") and the
+ * component type and parameters are given for each role.  Vertices
+ * with a role that has no component type are skipped along with their
+ * links, so only the parts of the topology that are needed are built.
+ */
+class GraphGenerator
+{
+public:
+    SST_ELI_DECLARE_BASE(GraphGenerator)
+    SST_ELI_DECLARE_INFO_EXTERN(ELI::ProvidesParams)
+    SST_ELI_DECLARE_CTOR_EXTERN(SST::Params&)
+
+    /** Role of a vertex and its index among the vertices of that role */
+    struct Vertex
+    {
+        uint32_t role;
+        uint64_t index;
+    };
+
+    /** Link from a vertex to one of its neighbors */
+    struct Edge
+    {
+        uint64_t neighbor;    /*!< Vertex on the other end of the link */
+        uint32_t port;        /*!< Port number on this vertex */
+        uint32_t remote_port; /*!< Port number on the neighbor */
+        uint32_t latency;     /*!< Index into the link latencies */
+    };
+
+    /** Component type and parameters used for the vertices of a role */
+    struct ComponentSpec
+    {
+        std::string                                      type;
+        std::vector<std::pair<std::string, std::string>> params;
+        std::string                                      shared_param_set;
+    };
+
+    explicit GraphGenerator(Params& params);
+    virtual ~GraphGenerator() {}
+
+    /** Returns the number of vertices in the topology */
+    virtual uint64_t getNumVertices() const = 0;
+
+    /** Returns the role of vertex v */
+    virtual Vertex getVertex(uint64_t v) const = 0;
+
+    /** Fills in edges with the links of vertex v */
+    virtual void getEdges(uint64_t v, std::vector<Edge>& edges) const = 0;
+
+    /**
+       Fills in the coordinates of vertex v, which are used by the
+       geometric partitioners.  Returns false if the topology has no
+       coordinates.
+    */
+    virtual bool getCoordinates(uint64_t UNUSED(v), std::vector<double>& UNUSED(coords)) const { return false; }
+
+    /** Returns the name of a port of a vertex with the given role */
+    virtual std::string getPortName(uint32_t role, uint32_t port) const;
+
+    /** Returns the names of the vertex roles */
+    const std::vector<std::string>& getRoles() const { return roles; }
+
+    /**
+       Adds the components and links of the topology to graph.
+       Components are named name_prefix + role + index and the
+       component type and parameters are taken from specs, which is
+       indexed by role.
+
+       With parallel_load, the vertices are split into equal blocks
+       across the ranks and threads and only the components of this
+       rank's block are generated, along with the components on other
+       ranks they are connected to, so that the links to other ranks
+       can be created.  The rank of every generated component is set.
+
+       \return the number of components owned by this rank
+    */
+    uint64_t generate(ConfigGraph* graph, const std::string& name_prefix,
+        const std::map<std::string, ComponentSpec>& specs, RankInfo world_size, RankInfo my_rank, bool parallel_load);
+
+protected:
+    /** Names of the vertex roles, indexed by Vertex::role */
+    std::vector<std::string> roles;
+    /** Link latencies, indexed by Edge::latency */
+    std::vector<std::string> latencies;
+    /** Format of the port names, where %d is replaced by the port number */
+    std::string              port_format;
+    /** Port names to use instead of port_format, indexed by port number */
+    std::vector<std::string> port_names;
+
+    /** Returns format with %d replaced by num, or with num appended if there is no %d */
+    static std::string formatName(const std::string& format, uint64_t num);
+};
+
+} // namespace SST
+
+#ifndef SST_ELI_REGISTER_GRAPH_GENERATOR
+#define SST_ELI_REGISTER_GRAPH_GENERATOR(cls, lib, name, version, desc) \
+    SST_ELI_REGISTER_DERIVED(SST::GraphGenerator,cls,lib,name,ELI_FORWARD_AS_ONE(version),desc)
+#endif
+
+#endif // SST_CORE_GRAPHGENERATOR_H
@@ -0,0 +1,106 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/graphgen/dragonflygen.h"
+
+#include <stdexcept>
+
+namespace SST::IMPL::GraphGen {
+
+SSTDragonflyGenerator::SSTDragonflyGenerator(Params& params) :
+    GraphGenerator(params)
+{
+    roles.push_back("router");
+    roles.push_back("host");
+
+    routers_per_group = params.find<uint32_t>("routers_per_group", 4);
+    hosts_per_router  = params.find<uint32_t>("hosts_per_router", 2);
+    global_ports      = params.find<uint32_t>("global_ports", 2);
+    groups            = params.find<uint32_t>("groups", routers_per_group * global_ports + 1);
+    host_port         = params.find<std::string>("host_port", "port0");
+    if ( routers_per_group == 0 || groups == 0 ) {
+        throw std::invalid_argument("routers_per_group and groups must be greater than 0");
+    }
+
+    latencies.push_back(params.find<std::string>("host_latency", latencies[0]));
+    latencies.push_back(params.find<std::string>("local_latency", latencies[0]));
+    latencies.push_back(params.find<std::string>("global_latency", latencies[0]));
+
+    num_routers = static_cast<uint64_t>(routers_per_group) * groups;
+
+    // Only use as many global links as are needed to connect each
+    // group to every other group the same number of times
+    const uint64_t group_links = static_cast<uint64_t>(routers_per_group) * global_ports;
+    connected_global_links     = groups > 1 ? group_links - group_links % (groups - 1) : 0;
+}
+
+GraphGenerator::Vertex
+SSTDragonflyGenerator::getVertex(uint64_t v) const
+{
+    const uint64_t router = v / (hosts_per_router + 1);
+    const uint64_t offset = v % (hosts_per_router + 1);
+    if ( offset == 0 ) return { ROUTER, router };
+    return { HOST, router * hosts_per_router + offset - 1 };
+}
+
+void
+SSTDragonflyGenerator::getEdges(uint64_t v, std::vector<Edge>& edges) const
+{
+    const uint64_t router = v / (hosts_per_router + 1);
+    const uint32_t offset = v % (hosts_per_router + 1);
+    if ( offset != 0 ) {
+        edges.push_back({ routerVertex(router), 0, offset - 1, HOST_LATENCY });
+        return;
+    }
+
+    // Hosts
+    for ( uint32_t i = 0; i < hosts_per_router; ++i ) {
+        edges.push_back({ v + 1 + i, i, 0, HOST_LATENCY });
+    }
+
+    // Routers in the same group
+    const uint64_t group       = router / routers_per_group;
+    const uint32_t r           = router % routers_per_group;
+    const uint32_t local_base  = hosts_per_router;
+    const uint32_t global_base = hosts_per_router + routers_per_group - 1;
+    for ( uint32_t other = 0; other < routers_per_group; ++other ) {
+        if ( other == r ) continue;
+        const uint32_t port        = local_base + (other < r ? other : other - 1);
+        const uint32_t remote_port = local_base + (r < other ? r : r - 1);
+        edges.push_back(
+            { routerVertex(group * routers_per_group + other), port, remote_port, LOCAL_LATENCY });
+    }
+
+    // Other groups
+    for ( uint32_t j = 0; j < global_ports; ++j ) {
+        const uint64_t link = static_cast<uint64_t>(r) * global_ports + j;
+        if ( link >= connected_global_links ) break;
+
+        const uint64_t round        = link / (groups - 1);
+        const uint64_t distance     = link % (groups - 1);
+        const uint64_t remote_group = (group + distance + 1) % groups;
+        const uint64_t remote_link  = round * (groups - 1) + (groups - 2 - distance);
+        const uint64_t remote       = remote_group * routers_per_group + remote_link / global_ports;
+        edges.push_back({ routerVertex(remote), global_base + j,
+            static_cast<uint32_t>(global_base + remote_link % global_ports), GLOBAL_LATENCY });
+    }
+}
+
+std::string
+SSTDragonflyGenerator::getPortName(uint32_t role, uint32_t port) const
+{
+    if ( role == HOST ) return host_port;
+    return GraphGenerator::getPortName(role, port);
+}
+
+} // namespace SST::IMPL::GraphGen
@@ -0,0 +1,90 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_GRAPHGEN_DRAGONFLYGEN_H
+#define SST_CORE_IMPL_GRAPHGEN_DRAGONFLYGEN_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/graphGenerator.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SST::IMPL::GraphGen {
+
+/**
+   Generates a dragonfly.  Each group has a routers that are all
+   connected to each other and each router has p hosts and h global
+   links to other groups.  Router ports 0 to p-1 connect to the hosts,
+   ports p to p+a-2 connect to the other routers in the group and
+   ports p+a-1 to p+a+h-2 are the global links.
+
+   Global link i of a group (router i / h, global port i % h) goes to
+   the group (i % (g-1)) + 1 groups after it, so that each group is
+   connected to every other group the same number of times.  Global
+   ports that are left over are not connected.
+
+   Each router is followed by its hosts in the vertex order, so a
+   router and its hosts are always loaded on the same rank.
+*/
+class SSTDragonflyGenerator : public SST::GraphGenerator
+{
+public:
+    SST_ELI_REGISTER_GRAPH_GENERATOR(
+        SSTDragonflyGenerator,
+        "sst",
+        "dragonfly",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Generates a dragonfly with all-to-all connected routers in each group.  Router ports are numbered hosts "
+        "first, then local links, then global links.  Roles: router, host")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "routers_per_group", "Number of routers in each group (a)", "4" },
+        { "hosts_per_router", "Number of hosts on each router (p)", "2" },
+        { "global_ports", "Number of global links on each router (h)", "2" },
+        { "groups", "Number of groups (g), defaults to a*h+1", "" },
+        { "link_latency", "Default latency of the links", "1ns" },
+        { "host_latency", "Latency of the host links, defaults to link_latency", "" },
+        { "local_latency", "Latency of the links within a group, defaults to link_latency", "" },
+        { "global_latency", "Latency of the links between groups, defaults to link_latency", "" },
+        { "port_name", "Format of the router port names, %d is replaced by the port number", "port%d" },
+        { "port_names", "Array of router port names to use instead of port_name, indexed by port number", "" },
+        { "host_port", "Name of the host port", "port0" }
+    )
+
+    explicit SSTDragonflyGenerator(Params& params);
+    ~SSTDragonflyGenerator() {}
+
+    uint64_t    getNumVertices() const override { return num_routers * (hosts_per_router + 1); }
+    Vertex      getVertex(uint64_t v) const override;
+    void        getEdges(uint64_t v, std::vector<Edge>& edges) const override;
+    std::string getPortName(uint32_t role, uint32_t port) const override;
+
+protected:
+    enum Role : uint32_t { ROUTER = 0, HOST = 1 };
+    enum Latency : uint32_t { HOST_LATENCY = 1, LOCAL_LATENCY = 2, GLOBAL_LATENCY = 3 };
+
+    uint32_t    routers_per_group;
+    uint32_t    hosts_per_router;
+    uint32_t    global_ports;
+    uint32_t    groups;
+    uint64_t    num_routers;
+    /** Number of global links of each group that are connected */
+    uint64_t    connected_global_links;
+    std::string host_port;
+
+    uint64_t routerVertex(uint64_t router) const { return router * (hosts_per_router + 1); }
+};
+
+} // namespace SST::IMPL::GraphGen
+
+#endif // SST_CORE_IMPL_GRAPHGEN_DRAGONFLYGEN_H
@@ -0,0 +1,96 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/graphgen/fattreegen.h"
+
+#include <stdexcept>
+
+namespace SST::IMPL::GraphGen {
+
+SSTFatTreeGenerator::SSTFatTreeGenerator(Params& params) :
+    GraphGenerator(params)
+{
+    roles.push_back("host");
+    roles.push_back("switch");
+
+    radix     = params.find<uint32_t>("radix", 4);
+    levels    = params.find<uint32_t>("levels", 2);
+    host_port = params.find<std::string>("host_port", "port0");
+    if ( radix == 0 || levels == 0 ) throw std::invalid_argument("radix and levels must be greater than 0");
+
+    switches_per_level = 1;
+    for ( uint32_t l = 1; l < levels; ++l ) {
+        switches_per_level *= radix;
+    }
+    num_hosts = switches_per_level * radix;
+}
+
+GraphGenerator::Vertex
+SSTFatTreeGenerator::getVertex(uint64_t v) const
+{
+    if ( v < num_hosts ) return { HOST, v };
+    return { SWITCH, v - num_hosts };
+}
+
+void
+SSTFatTreeGenerator::getEdges(uint64_t v, std::vector<Edge>& edges) const
+{
+    if ( v < num_hosts ) {
+        edges.push_back({ num_hosts + v / radix, 0, static_cast<uint32_t>(v % radix), 0 });
+        return;
+    }
+
+    const uint64_t index = v - num_hosts;
+    const uint32_t level = index / switches_per_level;
+    const uint64_t w     = index % switches_per_level;
+
+    // Place value of the digit that changes between this level and
+    // the ones above and below
+    uint64_t up_place = 1;
+    for ( uint32_t l = 0; l < level; ++l ) {
+        up_place *= radix;
+    }
+    const uint64_t down_place = up_place / radix;
+
+    // Down links
+    if ( level == 0 ) {
+        for ( uint32_t j = 0; j < radix; ++j ) {
+            edges.push_back({ w * radix + j, j, 0, 0 });
+        }
+    }
+    else {
+        const uint64_t digit = (w / down_place) % radix;
+        const uint64_t base  = num_hosts + (level - 1) * switches_per_level + w - digit * down_place;
+        for ( uint32_t j = 0; j < radix; ++j ) {
+            edges.push_back({ base + j * down_place, j, static_cast<uint32_t>(radix + digit), 0 });
+        }
+    }
+
+    // Up links
+    if ( level + 1 < levels ) {
+        const uint64_t digit = (w / up_place) % radix;
+        const uint64_t base  = num_hosts + (level + 1) * switches_per_level + w - digit * up_place;
+        for ( uint32_t j = 0; j < radix; ++j ) {
+            edges.push_back({ base + j * up_place, radix + j, static_cast<uint32_t>(digit), 0 });
+        }
+    }
+}
+
+std::string
+SSTFatTreeGenerator::getPortName(uint32_t role, uint32_t port) const
+{
+    if ( role == HOST ) return host_port;
+    return GraphGenerator::getPortName(role, port);
+}
+
+} // namespace SST::IMPL::GraphGen
@@ -0,0 +1,74 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_GRAPHGEN_FATTREEGEN_H
+#define SST_CORE_IMPL_GRAPHGEN_FATTREEGEN_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/graphGenerator.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SST::IMPL::GraphGen {
+
+/**
+   Generates a k-ary n-tree fat tree.  There are k^n hosts and n
+   levels of k^(n-1) switches, with level 0 connected to the hosts.
+   Switch ports 0 to k-1 connect down the tree and ports k to 2k-1
+   connect up the tree.  Switch w at level l connects to the switches
+   at level l+1 that differ from w only in base k digit l.
+
+   Hosts are vertices 0 to k^n-1 and the switches follow, in order of
+   level.  Hosts have a single port.
+*/
+class SSTFatTreeGenerator : public SST::GraphGenerator
+{
+public:
+    SST_ELI_REGISTER_GRAPH_GENERATOR(
+        SSTFatTreeGenerator,
+        "sst",
+        "fattree",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Generates a k-ary n-tree fat tree.  Switch ports 0 to k-1 go down the tree and ports k to 2k-1 go up the "
+        "tree.  Roles: host, switch")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "radix", "Number of down (and up) ports on each switch (k)", "4" },
+        { "levels", "Number of levels of switches (n)", "2" },
+        { "link_latency", "Latency of the links", "1ns" },
+        { "port_name", "Format of the switch port names, %d is replaced by the port number", "port%d" },
+        { "port_names", "Array of switch port names to use instead of port_name, indexed by port number", "" },
+        { "host_port", "Name of the host port", "port0" }
+    )
+
+    explicit SSTFatTreeGenerator(Params& params);
+    ~SSTFatTreeGenerator() {}
+
+    uint64_t    getNumVertices() const override { return num_hosts + levels * switches_per_level; }
+    Vertex      getVertex(uint64_t v) const override;
+    void        getEdges(uint64_t v, std::vector<Edge>& edges) const override;
+    std::string getPortName(uint32_t role, uint32_t port) const override;
+
+protected:
+    enum Role : uint32_t { HOST = 0, SWITCH = 1 };
+
+    uint32_t    radix;
+    uint32_t    levels;
+    uint64_t    num_hosts;
+    uint64_t    switches_per_level;
+    std::string host_port;
+};
+
+} // namespace SST::IMPL::GraphGen
+
+#endif // SST_CORE_IMPL_GRAPHGEN_FATTREEGEN_H
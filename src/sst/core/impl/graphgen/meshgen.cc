@@ -0,0 +1,78 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/graphgen/meshgen.h"
+
+#include <stdexcept>
+
+namespace SST::IMPL::GraphGen {
+
+SSTMeshGenerator::SSTMeshGenerator(Params& params) :
+    SSTMeshGenerator(params, false)
+{}
+
+SSTMeshGenerator::SSTMeshGenerator(Params& params, bool wrap) :
+    GraphGenerator(params),
+    wrap(wrap)
+{
+    roles.push_back("router");
+
+    params.find_array<uint64_t>("shape", shape);
+    if ( shape.empty() ) shape = { 4, 4 };
+
+    num_vertices = 1;
+    for ( uint64_t size : shape ) {
+        if ( size == 0 ) throw std::invalid_argument("shape must not contain a dimension of size 0");
+        num_vertices *= size;
+    }
+}
+
+void
+SSTMeshGenerator::getEdges(uint64_t v, std::vector<Edge>& edges) const
+{
+    uint64_t stride = 1;
+    for ( size_t d = 0; d < shape.size(); ++d ) {
+        const uint64_t size = shape[d];
+        const uint64_t x    = (v / stride) % size;
+        const uint32_t pos  = 2 * d;
+        const uint32_t neg  = 2 * d + 1;
+
+        if ( x + 1 < size )
+            edges.push_back({ v + stride, pos, neg, 0 });
+        else if ( wrap )
+            edges.push_back({ v - x * stride, pos, neg, 0 });
+
+        if ( x > 0 )
+            edges.push_back({ v - stride, neg, pos, 0 });
+        else if ( wrap )
+            edges.push_back({ v + (size - 1) * stride, neg, pos, 0 });
+
+        stride *= size;
+    }
+}
+
+bool
+SSTMeshGenerator::getCoordinates(uint64_t v, std::vector<double>& coords) const
+{
+    for ( uint64_t size : shape ) {
+        coords.push_back(static_cast<double>(v % size));
+        v /= size;
+    }
+    return true;
+}
+
+SSTTorusGenerator::SSTTorusGenerator(Params& params) :
+    SSTMeshGenerator(params, true)
+{}
+
+} // namespace SST::IMPL::GraphGen
@@ -0,0 +1,89 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_GRAPHGEN_MESHGEN_H
+#define SST_CORE_IMPL_GRAPHGEN_MESHGEN_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/graphGenerator.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SST::IMPL::GraphGen {
+
+/**
+   Generates an n-dimensional mesh of routers.  Router coordinates
+   are numbered with the first dimension varying fastest.  In
+   dimension d, port 2d connects to the next router in the positive
+   direction and port 2d+1 to the next router in the negative
+   direction.  The router coordinates are set as the component
+   coordinates.
+*/
+class SSTMeshGenerator : public SST::GraphGenerator
+{
+public:
+    SST_ELI_REGISTER_GRAPH_GENERATOR(
+        SSTMeshGenerator,
+        "sst",
+        "mesh",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Generates an n-dimensional mesh.  Port 2d is the positive and port 2d+1 the negative direction of "
+        "dimension d.  Roles: router")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "shape", "Number of routers in each dimension, e.g. [4, 4, 2]", "[4, 4]" },
+        { "link_latency", "Latency of the links", "1ns" },
+        { "port_name", "Format of the port names, %d is replaced by the port number", "port%d" },
+        { "port_names", "Array of port names to use instead of port_name, indexed by port number", "" }
+    )
+
+    explicit SSTMeshGenerator(Params& params);
+    ~SSTMeshGenerator() {}
+
+    uint64_t getNumVertices() const override { return num_vertices; }
+    Vertex   getVertex(uint64_t v) const override { return { 0, v }; }
+    void     getEdges(uint64_t v, std::vector<Edge>& edges) const override;
+    bool     getCoordinates(uint64_t v, std::vector<double>& coords) const override;
+
+protected:
+    /** Number of routers in each dimension */
+    std::vector<uint64_t> shape;
+    /** Total number of routers */
+    uint64_t              num_vertices;
+    /** Whether the edges of each dimension wrap around */
+    bool                  wrap;
+
+    SSTMeshGenerator(Params& params, bool wrap);
+};
+
+/**
+   Generates an n-dimensional torus of routers.  This is a mesh where
+   the links in each dimension wrap around.
+*/
+class SSTTorusGenerator : public SSTMeshGenerator
+{
+public:
+    SST_ELI_REGISTER_GRAPH_GENERATOR(
+        SSTTorusGenerator,
+        "sst",
+        "torus",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Generates an n-dimensional torus.  Port 2d is the positive and port 2d+1 the negative direction of "
+        "dimension d.  Roles: router")
+
+    explicit SSTTorusGenerator(Params& params);
+    ~SSTTorusGenerator() {}
+};
+
+} // namespace SST::IMPL::GraphGen
+
+#endif // SST_CORE_IMPL_GRAPHGEN_MESHGEN_H
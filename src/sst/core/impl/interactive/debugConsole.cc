@@ -14,6 +14,7 @@
 #include "sst/core/impl/interactive/debugConsole.h"
 
 #include "sst/core/baseComponent.h"
+#include "sst/core/checkpointAction.h"
 #include "sst/core/impl/interactive/ObjMapToTree.h"
 #include "sst/core/impl/interactive/ObjTreeHelpers.h"
 #include "sst/core/simulation.h"
@@ -38,6 +39,8 @@ unsigned                 DebugConsole::current_thread = 0;
 unsigned                 DebugConsole::current_rank   = 0;
 std::vector<std::string> DebugConsole::tokens;
 std::stringstream        DebugConsole::result;
+std::string              DebugConsole::rewindReplayFilePath;
+std::streampos           DebugConsole::rewindReplayPos;
 
 
 DebugConsole::DebugConsole(Params& params) :
@@ -65,9 +68,19 @@ DebugConsole::DebugConsole(Params& params) :
         exec_type = ExecutionType::RANK_PARALLEL;
     }
 
-    // We can specify a replay file from the sst command line.
+    // We can specify a replay file from the sst command line.  After a
+    // rewind, the replay continues where it was when the rewind was
+    // requested instead of starting over.
     std::string sstReplayFilePath = params.find<std::string>("replayFile", "");
-    if ( sstReplayFilePath.size() > 0 ) injectedCommand << "replay " << sstReplayFilePath << std::endl;
+    if ( rewindReplayFilePath.size() > 0 ) {
+        replayFilePath = rewindReplayFilePath;
+        replayFile.open(replayFilePath);
+        replayFile.seekg(rewindReplayPos);
+        rewindReplayFilePath.clear();
+    }
+    else if ( sstReplayFilePath.size() > 0 ) {
+        injectedCommand << "replay " << sstReplayFilePath << std::endl;
+    }
 
     // Populate the command registry
     cmdRegistry = CommandRegistry({
@@ -304,6 +317,10 @@ DebugConsole::DebugConsole(Params& params) :
             [this](std::vector<std::string>& tokens) { return clear_watchlist(tokens); } },
         { "shutdown", "shutd", ": exit the debugger and cleanly shutdown simulator", ConsoleCommandGroup::SIMULATION,
             [this](std::string& cmd_str) { return cmd_shutdown(cmd_str); } },
+        { "snapshots", "snap", ": list the checkpoints kept in memory (see 'sst --checkpoint-memory')",
+            ConsoleCommandGroup::SIMULATION, [this](std::string& cmd_str) { return cmd_snapshots(cmd_str); } },
+        { "rewind", "rew", "<N>: restart the simulation from the checkpoint kept in memory with index N",
+            ConsoleCommandGroup::SIMULATION, [this](std::string& cmd_str) { return cmd_rewind(cmd_str); } },
         // Logging/Replay
         { "logging", "log", "<filepath>: log command line entries to file", ConsoleCommandGroup::LOGGING,
             [this](std::string& cmd_str) { return cmd_logging(cmd_str); } },
@@ -4196,6 +4213,58 @@ DebugConsole::cmd_shutdown(std::string& UNUSED(cmd_str))
     return true;
 }
 
+// snapshots : list the checkpoints kept in memory
+bool
+DebugConsole::cmd_snapshots(std::string& UNUSED(cmd_str))
+{
+    auto& snapshots = CheckpointAction::memory_checkpoints;
+    if ( snapshots.empty() ) {
+        std::cout << "No checkpoints in memory (enable with 'sst --checkpoint-memory=N')" << std::endl;
+        return true;
+    }
+    for ( size_t i = 0; i < snapshots.size(); ++i ) {
+        size_t bytes = 0;
+        for ( auto& file : snapshots[i]->files )
+            bytes += file.second.size();
+        std::cout << i << ": time = " << snapshots[i]->time << " (" << bytes << " bytes)" << std::endl;
+    }
+    return true;
+}
+
+// rewind <N> : restart the simulation from a checkpoint kept in memory
+bool
+DebugConsole::cmd_rewind(std::string& UNUSED(cmd_str))
+{
+    auto& snapshots = CheckpointAction::memory_checkpoints;
+    if ( tokens.size() != 2 ) {
+        std::cout << "Invalid format for rewind command (rewind <N>)" << std::endl;
+        return false;
+    }
+    size_t index = snapshots.size();
+    try {
+        index = SST::Core::from_string<size_t>(tokens[1]);
+    }
+    catch ( ... ) {
+        // Reported as an unknown checkpoint below
+    }
+    if ( index >= snapshots.size() ) {
+        std::cout << "rewind: no checkpoint " << tokens[1] << " in memory (see 'snapshots')" << std::endl;
+        return false;
+    }
+
+    // The run ends and the simulation is restarted from the checkpoint,
+    // entering the console again at its time
+    CheckpointAction::rewind_checkpoint = snapshots[index].get();
+    if ( replayFile.is_open() ) {
+        rewindReplayFilePath = replayFilePath;
+        rewindReplayPos      = replayFile.tellg();
+    }
+    std::cout << "Rewinding to time " << snapshots[index]->time << std::endl;
+    Simulation::getSimulation()->consoleShutdown(false);
+    exit_console = true;
+    return true;
+}
+
 // ---- Command History Buffer Functions ----
 void
 CommandHistoryBuffer::append(std::string s)
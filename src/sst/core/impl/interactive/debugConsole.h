@@ -106,6 +106,11 @@ private:
     // command injection (for sst --replay option)
     std::stringstream injectedCommand;
 
+    // Replay file and position when the simulation was rewound, so the
+    // console of the rewound simulation continues the replay
+    static std::string    rewindReplayFilePath;
+    static std::streampos rewindReplayPos;
+
     // execution state management for nested user commands
     ExecState             eState = {};
     std::stack<ExecState> eStack = {};
@@ -247,6 +252,8 @@ private:
     bool cmd_exit_rank_parallel(std::string& cmd_str);
 
     bool cmd_shutdown(std::string& cmd_str);
+    bool cmd_snapshots(std::string& cmd_str);
+    bool cmd_rewind(std::string& cmd_str);
 
     // Logging/Replay
     bool cmd_logging(std::string& cmd_str);
@@ -0,0 +1,202 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/lookaheadpart.h"
+
+#include "sst/core/config.h"
+#include "sst/core/model/configGraph.h"
+#include "sst/core/simulation.h"
+#include "sst/core/timeLord.h"
+#include "sst/core/unitAlgebra.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <numeric>
+#include <string>
+#include <utility>
+
+namespace SST::IMPL::Partition {
+
+namespace {
+
+// Union-find over the vertices of the partition graph, tracking the
+// total weight of each set
+class DisjointSets
+{
+public:
+    explicit DisjointSets(const std::vector<double>& vwgt) :
+        parent(vwgt.size()),
+        weight(vwgt)
+    {
+        std::iota(parent.begin(), parent.end(), 0);
+    }
+
+    uint32_t find(uint32_t v)
+    {
+        while ( parent[v] != v ) {
+            parent[v] = parent[parent[v]];
+            v         = parent[v];
+        }
+        return v;
+    }
+
+    // Returns the weight of the combined set
+    double merge(uint32_t u, uint32_t v)
+    {
+        u = find(u);
+        v = find(v);
+        if ( u == v ) return weight[u];
+        if ( weight[u] < weight[v] ) std::swap(u, v);
+        parent[v] = u;
+        weight[u] += weight[v];
+        return weight[u];
+    }
+
+private:
+    std::vector<uint32_t> parent;
+    std::vector<double>   weight;
+};
+
+} // anonymous namespace
+
+SSTLookaheadPartition::SSTLookaheadPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity) :
+    SSTMultilevelPartition(total_ranks, my_rank, verbosity, "LookaheadPartition "),
+    lookahead(0)
+{
+    const std::string& lookahead_str = Simulation::config.partitioner_lookahead();
+    if ( !lookahead_str.empty() ) {
+        lookahead = Simulation::getTimeLord()->getSimCycles(lookahead_str, "partitioner-lookahead");
+    }
+}
+
+SimTime_t
+SSTLookaheadPartition::findThreshold(PartitionGraph* pgraph, const std::vector<double>& vwgt, double max_cluster)
+{
+    std::vector<std::pair<SimTime_t, size_t>> order;
+    order.reserve(link_ends.size());
+    size_t link_index = 0;
+    for ( auto& link : pgraph->getLinkMap() ) {
+        if ( link_ends[link_index][1] != NO_VERTEX ) order.push_back({ link.getMinLatency(), link_index });
+        link_index++;
+    }
+    std::sort(order.begin(), order.end());
+
+    // Merge links in order of increasing latency.  All links with the
+    // same latency have to be merged together, so the threshold is the
+    // first latency whose links create a cluster that is too heavy.
+    DisjointSets sets(vwgt);
+    for ( size_t i = 0; i < order.size(); ) {
+        const SimTime_t latency = order[i].first;
+        for ( ; i < order.size() && order[i].first == latency; i++ ) {
+            const auto& ends = link_ends[order[i].second];
+            if ( sets.merge(ends[0], ends[1]) > max_cluster ) return latency;
+        }
+    }
+    return MAX_SIMTIME_T;
+}
+
+uint32_t
+SSTLookaheadPartition::buildClusters(PartitionGraph* pgraph, SimTime_t threshold, std::vector<uint32_t>& cluster)
+{
+    const uint32_t n = pgraph->getComponentMap().size();
+
+    DisjointSets sets(std::vector<double>(n, 0.0));
+    size_t       link_index = 0;
+    for ( auto& link : pgraph->getLinkMap() ) {
+        const auto& ends = link_ends[link_index++];
+        if ( ends[1] == NO_VERTEX || link.getMinLatency() >= threshold ) continue;
+        sets.merge(ends[0], ends[1]);
+    }
+
+    // Number the clusters in order of their lowest vertex
+    std::vector<uint32_t> root_cluster(n, NO_VERTEX);
+    uint32_t              count = 0;
+    cluster.resize(n);
+    for ( uint32_t v = 0; v < n; v++ ) {
+        uint32_t root = sets.find(v);
+        if ( root_cluster[root] == NO_VERTEX ) root_cluster[root] = count++;
+        cluster[v] = root_cluster[root];
+    }
+    return count;
+}
+
+void
+SSTLookaheadPartition::performPartition(PartitionGraph* pgraph)
+{
+    PartitionComponentMap_t& comps = pgraph->getComponentMap();
+
+    part_output.verbose(CALL_INFO, 1, 0, "Performing a lookahead maximizing partition scheme for simulation model.\n");
+
+    std::vector<double> vwgt;
+    getVertexWeights(pgraph, vwgt);
+    findLinkEnds(pgraph);
+
+    // Unless a threshold was given, allow clusters up to the imbalance
+    // tolerance of a part so that they can always be balanced
+    SimTime_t threshold = lookahead;
+    if ( threshold == 0 ) {
+        const double avg_part    = std::accumulate(vwgt.begin(), vwgt.end(), 0.0) / total_parts;
+        const double max_vertex  = vwgt.empty() ? 0.0 : *std::max_element(vwgt.begin(), vwgt.end());
+        const double max_cluster = std::max(avg_part * imbalance_tol, max_vertex);
+        threshold                = findThreshold(pgraph, vwgt, max_cluster);
+    }
+
+    std::vector<uint32_t> cluster;
+    const uint32_t        num_clusters = buildClusters(pgraph, threshold, cluster);
+
+    if ( threshold == MAX_SIMTIME_T ) {
+        part_output.verbose(CALL_INFO, 1, 0, "- Latency threshold:                      none\n");
+    }
+    else {
+        UnitAlgebra threshold_time = Simulation::getTimeLord()->getTimeBase() * threshold;
+        part_output.verbose(
+            CALL_INFO, 1, 0, "- Latency threshold:                %10s\n", threshold_time.toStringBestSI().c_str());
+    }
+    part_output.verbose(CALL_INFO, 1, 0, "- Vertex Count:                     %10zu\n", vwgt.size());
+    part_output.verbose(CALL_INFO, 1, 0, "- Cluster Count:                    %10" PRIu32 "\n", num_clusters);
+    part_output.verbose(CALL_INFO, 1, 0, "- Part Count:                       %10" PRIu32 "\n", total_parts);
+
+    // Build the graph of clusters.  Only links at or above the
+    // threshold connect different clusters.
+    std::vector<double> cluster_wgt(num_clusters, 0.0);
+    for ( size_t v = 0; v < vwgt.size(); v++ ) {
+        cluster_wgt[cluster[v]] += vwgt[v];
+    }
+
+    std::vector<Edge> edges;
+    size_t            link_index = 0;
+    for ( auto& link : pgraph->getLinkMap() ) {
+        const auto& ends = link_ends[link_index++];
+        if ( ends[1] == NO_VERTEX || cluster[ends[0]] == cluster[ends[1]] ) continue;
+        edges.push_back({ cluster[ends[0]], cluster[ends[1]], getEdgeWeight(link) });
+    }
+
+    Graph graph;
+    buildFromEdges(cluster_wgt, edges, graph);
+
+    std::vector<uint32_t> cluster_part;
+    partitionGraph(graph, total_parts, cluster_part);
+
+    std::vector<uint32_t> part(vwgt.size());
+    uint32_t              index = 0;
+    for ( auto* comp : comps ) {
+        part[index] = cluster_part[cluster[index]];
+        comp->rank  = convertPartNum(part[index]);
+        index++;
+    }
+
+    reportPartition(pgraph, vwgt, part);
+    part_output.verbose(CALL_INFO, 1, 0, "Lookahead partition scheme completed.\n");
+}
+
+} // namespace SST::IMPL::Partition
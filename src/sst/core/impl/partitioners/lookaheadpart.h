@@ -0,0 +1,79 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_LOOKAHEADPART_H
+#define SST_CORE_IMPL_PARTITONERS_LOOKAHEADPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/impl/partitioners/multilevelpart.h"
+#include "sst/core/model/configGraph.h"
+#include "sst/core/sst_types.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SST::IMPL::Partition {
+
+/**
+   Partitioner that maximizes the simulation lookahead, which is the
+   minimum latency of any link crossing a rank/thread boundary.
+
+   All links with a latency below a threshold are treated as uncuttable
+   and the components they join are collapsed into clusters.  The
+   cluster graph is then balanced using the multilevel partitioner.
+   The threshold can be given with --partitioner-lookahead, otherwise
+   it is set to the largest link latency for which the clusters are
+   still small enough to allow a balanced partition.
+*/
+class SSTLookaheadPartition : public SSTMultilevelPartition
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTLookaheadPartition,
+        "sst",
+        "lookahead",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Partitioner which avoids cutting links below a latency threshold (--partitioner-lookahead, or chosen "
+        "automatically) to maximize lookahead, then balances component weights across ranks and threads.")
+
+private:
+    /** Latency threshold from --partitioner-lookahead, 0 if not set */
+    SimTime_t lookahead;
+
+    /**
+       Returns the largest latency threshold for which no cluster of
+       components joined by links below the threshold is heavier than
+       max_cluster.
+    */
+    SimTime_t findThreshold(PartitionGraph* pgraph, const std::vector<double>& vwgt, double max_cluster);
+
+    /**
+       Assigns each vertex to a cluster, where vertices joined by a
+       link with latency below threshold share a cluster.  Returns the
+       number of clusters.
+    */
+    uint32_t buildClusters(PartitionGraph* pgraph, SimTime_t threshold, std::vector<uint32_t>& cluster);
+
+public:
+    SSTLookaheadPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity);
+    ~SSTLookaheadPartition() {}
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+};
+
+} // namespace SST::IMPL::Partition
+
+#endif // SST_CORE_IMPL_PARTITONERS_LOOKAHEADPART_H
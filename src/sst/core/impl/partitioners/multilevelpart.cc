@@ -0,0 +1,684 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/multilevelpart.h"
+
+#include "sst/core/config.h"
+#include "sst/core/model/configGraph.h"
+#include "sst/core/simulation.h"
+#include "sst/core/timeLord.h"
+#include "sst/core/unitAlgebra.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <utility>
+
+namespace SST::IMPL::Partition {
+
+namespace {
+
+// Coarsening stops once a graph has this many vertices or fewer
+constexpr uint32_t coarsen_to = 64;
+
+// Number of seeds to try when growing the initial bisection
+constexpr uint32_t initial_tries = 8;
+
+// Maximum number of Fiduccia-Mattheyses passes per level
+constexpr int refine_passes = 8;
+
+using GainEntry = std::pair<double, uint32_t>;
+
+// Amount of weight by which the two sides exceed their maximums
+double
+excessWeight(const double wgt[2], const double max_wgt[2])
+{
+    return std::max(0.0, wgt[0] - max_wgt[0]) + std::max(0.0, wgt[1] - max_wgt[1]);
+}
+
+} // anonymous namespace
+
+double
+SSTMultilevelPartition::Graph::totalWeight() const
+{
+    return std::accumulate(vwgt.begin(), vwgt.end(), 0.0);
+}
+
+double
+SSTMultilevelPartition::Graph::maxVertexWeight() const
+{
+    if ( vwgt.empty() ) return 0.0;
+    return *std::max_element(vwgt.begin(), vwgt.end());
+}
+
+SSTMultilevelPartition::SSTMultilevelPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity) :
+    SSTMultilevelPartition(total_ranks, my_rank, verbosity, "MultilevelPartition ")
+{}
+
+SSTMultilevelPartition::SSTMultilevelPartition(
+    RankInfo total_ranks, RankInfo UNUSED(my_rank), int verbosity, const std::string& prefix) :
+    SSTPartitioner(),
+    world_size(total_ranks),
+    total_parts(total_ranks.rank * total_ranks.thread),
+    part_output(prefix, verbosity, 0, Output::STDOUT),
+    imbalance_tol(Simulation::config.partitioner_imbalance() - 1.0),
+    rng(7, 13)
+{}
+
+double
+SSTMultilevelPartition::getEdgeWeight(const PartitionLink& link)
+{
+    SimTime_t latency = link.getMinLatency();
+    return (1.0 + link.traffic_) / (latency == 0 ? 1 : latency);
+}
+
+void
+SSTMultilevelPartition::getVertexWeights(PartitionGraph* pgraph, std::vector<double>& vwgt)
+{
+    PartitionComponentMap_t& comps = pgraph->getComponentMap();
+
+    vwgt.clear();
+    vwgt.reserve(comps.size());
+    for ( auto* comp : comps ) {
+        vwgt.push_back(comp->weight);
+    }
+
+    // If no weights were assigned, balance on number of components
+    if ( std::all_of(vwgt.begin(), vwgt.end(), [](double w) { return w <= 0.0; }) ) {
+        std::fill(vwgt.begin(), vwgt.end(), 1.0);
+    }
+}
+
+void
+SSTMultilevelPartition::findLinkEnds(PartitionGraph* pgraph)
+{
+    PartitionComponentMap_t& comps = pgraph->getComponentMap();
+    PartitionLinkMap_t&      links = pgraph->getLinkMap();
+
+    // In the collapsed partition graph, the component ids stored in
+    // the links are not remapped for links attached to subcomponents,
+    // so find the ends of each link by looking at which vertices
+    // reference it instead.  The link map is sorted by id, so a
+    // binary search gives the index for each link.
+    std::vector<LinkId_t> link_ids;
+    link_ids.reserve(links.size());
+    for ( auto& link : links ) {
+        link_ids.push_back(link.id_);
+    }
+
+    link_ends.assign(link_ids.size(), { NO_VERTEX, NO_VERTEX });
+
+    uint32_t index = 0;
+    for ( auto* comp : comps ) {
+        for ( LinkId_t id : comp->links ) {
+            auto it = std::lower_bound(link_ids.begin(), link_ids.end(), id);
+            if ( it == link_ids.end() || *it != id ) continue;
+
+            auto& ends = link_ends[it - link_ids.begin()];
+            if ( ends[0] == NO_VERTEX )
+                ends[0] = index;
+            else if ( ends[0] != index && ends[1] == NO_VERTEX )
+                ends[1] = index;
+        }
+        index++;
+    }
+}
+
+void
+SSTMultilevelPartition::buildGraph(PartitionGraph* pgraph, Graph& graph)
+{
+    std::vector<double> vwgt;
+    getVertexWeights(pgraph, vwgt);
+    findLinkEnds(pgraph);
+
+    std::vector<Edge> edges;
+    edges.reserve(link_ends.size());
+    size_t link_index = 0;
+    for ( auto& link : pgraph->getLinkMap() ) {
+        const auto& ends = link_ends[link_index++];
+        // Non-local links only have one end in this graph
+        if ( ends[1] == NO_VERTEX ) continue;
+        edges.push_back({ ends[0], ends[1], getEdgeWeight(link) });
+    }
+
+    buildFromEdges(vwgt, edges, graph);
+}
+
+void
+SSTMultilevelPartition::buildFromEdges(std::vector<double>& vwgt, std::vector<Edge>& edges, Graph& graph)
+{
+    const uint32_t n = vwgt.size();
+    graph.vwgt.swap(vwgt);
+
+    // Store each edge in both directions, then sort so that duplicate
+    // edges are adjacent and can be merged
+    std::vector<Edge> directed;
+    directed.reserve(edges.size() * 2);
+    for ( const auto& edge : edges ) {
+        if ( edge.u == edge.v ) continue;
+        directed.push_back(edge);
+        directed.push_back({ edge.v, edge.u, edge.weight });
+    }
+    edges.clear();
+    edges.shrink_to_fit();
+
+    std::sort(directed.begin(), directed.end(),
+        [](const Edge& lhs, const Edge& rhs) { return lhs.u < rhs.u || (lhs.u == rhs.u && lhs.v < rhs.v); });
+
+    graph.xadj.assign(n + 1, 0);
+    graph.adjncy.clear();
+    graph.adjwgt.clear();
+
+    for ( size_t i = 0; i < directed.size(); ) {
+        size_t j      = i;
+        double weight = 0.0;
+        while ( j < directed.size() && directed[j].u == directed[i].u && directed[j].v == directed[i].v ) {
+            weight += directed[j].weight;
+            j++;
+        }
+        graph.adjncy.push_back(directed[i].v);
+        graph.adjwgt.push_back(weight);
+        graph.xadj[directed[i].u + 1]++;
+        i = j;
+    }
+
+    for ( uint32_t v = 0; v < n; v++ ) {
+        graph.xadj[v + 1] += graph.xadj[v];
+    }
+}
+
+void
+SSTMultilevelPartition::coarsen(const Graph& graph, double max_vwgt, Graph& coarse, std::vector<uint32_t>& cmap)
+{
+    const uint32_t n = graph.size();
+
+    // Visit vertices in random order so that the matching isn't
+    // biased by component id
+    std::vector<uint32_t> perm(n);
+    std::iota(perm.begin(), perm.end(), 0);
+    for ( uint32_t i = n; i > 1; i-- ) {
+        std::swap(perm[i - 1], perm[rng.generateNextUInt32() % i]);
+    }
+
+    // Heavy edge matching: match each vertex with the unmatched
+    // neighbor it shares the heaviest edge with
+    std::vector<uint32_t> match(n, NO_VERTEX);
+    for ( uint32_t v : perm ) {
+        if ( match[v] != NO_VERTEX ) continue;
+
+        uint32_t best     = v;
+        double   best_wgt = -1.0;
+        for ( size_t j = graph.xadj[v]; j < graph.xadj[v + 1]; j++ ) {
+            uint32_t u = graph.adjncy[j];
+            if ( match[u] != NO_VERTEX || graph.vwgt[v] + graph.vwgt[u] > max_vwgt ) continue;
+            if ( graph.adjwgt[j] > best_wgt ) {
+                best     = u;
+                best_wgt = graph.adjwgt[j];
+            }
+        }
+        match[v]    = best;
+        match[best] = v;
+    }
+
+    // Number the coarse vertices in order of their lowest fine vertex
+    cmap.assign(n, NO_VERTEX);
+    std::vector<uint32_t> first;
+    for ( uint32_t v = 0; v < n; v++ ) {
+        if ( cmap[v] != NO_VERTEX ) continue;
+        cmap[v] = cmap[match[v]] = first.size();
+        first.push_back(v);
+    }
+
+    const uint32_t cn = first.size();
+    coarse.vwgt.assign(cn, 0.0);
+    coarse.xadj.assign(cn + 1, 0);
+    coarse.adjncy.clear();
+    coarse.adjwgt.clear();
+
+    // Merge the adjacency lists of the matched pairs.  where[] holds
+    // the position of each neighbor in the coarse vertex's adjacency
+    // list so duplicate edges can be combined.
+    std::vector<size_t> where(cn, SIZE_MAX);
+    for ( uint32_t c = 0; c < cn; c++ ) {
+        const uint32_t members[2] = { first[c], match[first[c]] };
+        const int      count      = members[0] == members[1] ? 1 : 2;
+        const size_t   start      = coarse.adjncy.size();
+
+        for ( int m = 0; m < count; m++ ) {
+            uint32_t v = members[m];
+            coarse.vwgt[c] += graph.vwgt[v];
+            for ( size_t j = graph.xadj[v]; j < graph.xadj[v + 1]; j++ ) {
+                uint32_t cu = cmap[graph.adjncy[j]];
+                if ( cu == c ) continue;
+                if ( where[cu] == SIZE_MAX ) {
+                    where[cu] = coarse.adjncy.size();
+                    coarse.adjncy.push_back(cu);
+                    coarse.adjwgt.push_back(graph.adjwgt[j]);
+                }
+                else {
+                    coarse.adjwgt[where[cu]] += graph.adjwgt[j];
+                }
+            }
+        }
+
+        for ( size_t j = start; j < coarse.adjncy.size(); j++ ) {
+            where[coarse.adjncy[j]] = SIZE_MAX;
+        }
+        coarse.xadj[c + 1] = coarse.adjncy.size();
+    }
+}
+
+void
+SSTMultilevelPartition::growBisection(
+    const Graph& graph, uint32_t seed, const double target[2], const double max_wgt[2], std::vector<uint8_t>& side)
+{
+    const uint32_t n = graph.size();
+    side.assign(n, 1);
+
+    // conn holds the weight of edges connecting each vertex to side 0
+    std::vector<double>  conn(n, 0.0);
+    std::vector<double>  degree(n, 0.0);
+    std::vector<uint8_t> rejected(n, 0);
+    for ( uint32_t v = 0; v < n; v++ ) {
+        for ( size_t j = graph.xadj[v]; j < graph.xadj[v + 1]; j++ ) {
+            degree[v] += graph.adjwgt[j];
+        }
+    }
+
+    auto gain = [&](uint32_t v) { return 2.0 * conn[v] - degree[v]; };
+
+    std::priority_queue<GainEntry> heap;
+    heap.push({ gain(seed), seed });
+
+    double   wgt0      = 0.0;
+    uint32_t next_free = 0;
+    while ( wgt0 < target[0] ) {
+        if ( heap.empty() ) {
+            // The region has absorbed its whole connected component,
+            // so continue growing from an unassigned vertex
+            while ( next_free < n && (side[next_free] == 0 || rejected[next_free]) ) {
+                next_free++;
+            }
+            if ( next_free == n ) break;
+            heap.push({ gain(next_free), next_free });
+        }
+
+        auto [g, v] = heap.top();
+        heap.pop();
+        if ( side[v] == 0 || rejected[v] || g != gain(v) ) continue;
+
+        if ( wgt0 + graph.vwgt[v] > max_wgt[0] ) {
+            rejected[v] = 1;
+            continue;
+        }
+
+        side[v] = 0;
+        wgt0 += graph.vwgt[v];
+        for ( size_t j = graph.xadj[v]; j < graph.xadj[v + 1]; j++ ) {
+            uint32_t u = graph.adjncy[j];
+            conn[u] += graph.adjwgt[j];
+            if ( side[u] == 1 && !rejected[u] ) heap.push({ gain(u), u });
+        }
+    }
+}
+
+double
+SSTMultilevelPartition::refineBisection(const Graph& graph, const double max_wgt[2], std::vector<uint8_t>& side)
+{
+    const uint32_t n = graph.size();
+
+    std::vector<double>   internal(n);
+    std::vector<double>   external(n);
+    std::vector<uint8_t>  locked(n);
+    std::vector<uint32_t> moves;
+
+    // Number of moves without improvement before a pass gives up
+    const size_t max_stall = std::clamp<size_t>(n / 100, 15, 100);
+
+    double cut = 0.0;
+    for ( int pass = 0; pass < refine_passes; pass++ ) {
+        double wgt[2] = { 0.0, 0.0 };
+        cut           = 0.0;
+        for ( uint32_t v = 0; v < n; v++ ) {
+            internal[v] = external[v] = 0.0;
+            wgt[side[v]] += graph.vwgt[v];
+            for ( size_t j = graph.xadj[v]; j < graph.xadj[v + 1]; j++ ) {
+                if ( side[graph.adjncy[j]] == side[v] )
+                    internal[v] += graph.adjwgt[j];
+                else
+                    external[v] += graph.adjwgt[j];
+            }
+            cut += external[v];
+        }
+        cut /= 2.0;
+
+        // One heap of candidate moves for each side.  Entries are
+        // lazily discarded when they no longer match the vertex gain.
+        std::priority_queue<GainEntry> heap[2];
+        std::fill(locked.begin(), locked.end(), 0);
+        for ( uint32_t v = 0; v < n; v++ ) {
+            if ( external[v] > 0.0 ) heap[side[v]].push({ external[v] - internal[v], v });
+        }
+
+        moves.clear();
+        double cur_cut     = cut;
+        double best_cut    = cut;
+        double best_excess = excessWeight(wgt, max_wgt);
+        size_t best_moves  = 0;
+
+        while ( true ) {
+            for ( int s = 0; s < 2; s++ ) {
+                while ( !heap[s].empty() ) {
+                    auto [g, v] = heap[s].top();
+                    if ( !locked[v] && side[v] == s && g == external[v] - internal[v] ) break;
+                    heap[s].pop();
+                }
+            }
+
+            int from = -1;
+            // A side above its maximum weight must give up vertices
+            if ( wgt[0] > max_wgt[0] && !heap[0].empty() )
+                from = 0;
+            else if ( wgt[1] > max_wgt[1] && !heap[1].empty() )
+                from = 1;
+            else {
+                for ( int s = 0; s < 2; s++ ) {
+                    if ( heap[s].empty() ) continue;
+                    uint32_t v = heap[s].top().second;
+                    if ( wgt[1 - s] + graph.vwgt[v] > max_wgt[1 - s] ) continue;
+                    if ( from < 0 || heap[s].top().first > heap[from].top().first ) from = s;
+                }
+
+                if ( from < 0 ) {
+                    // Neither best move keeps the balance, so lock
+                    // them and look at the next candidates
+                    bool any = false;
+                    for ( int s = 0; s < 2; s++ ) {
+                        if ( heap[s].empty() ) continue;
+                        locked[heap[s].top().second] = 1;
+                        heap[s].pop();
+                        any = true;
+                    }
+                    if ( !any ) break;
+                    continue;
+                }
+            }
+
+            auto [g, v] = heap[from].top();
+            heap[from].pop();
+            const int to = 1 - from;
+
+            side[v] = to;
+            wgt[from] -= graph.vwgt[v];
+            wgt[to] += graph.vwgt[v];
+            cur_cut -= g;
+            locked[v] = 1;
+            moves.push_back(v);
+
+            std::swap(internal[v], external[v]);
+            for ( size_t j = graph.xadj[v]; j < graph.xadj[v + 1]; j++ ) {
+                uint32_t u = graph.adjncy[j];
+                if ( side[u] == to ) {
+                    internal[u] += graph.adjwgt[j];
+                    external[u] -= graph.adjwgt[j];
+                }
+                else {
+                    internal[u] -= graph.adjwgt[j];
+                    external[u] += graph.adjwgt[j];
+                }
+                if ( !locked[u] ) heap[side[u]].push({ external[u] - internal[u], u });
+            }
+
+            double excess = excessWeight(wgt, max_wgt);
+            if ( excess < best_excess || (excess <= best_excess && cur_cut < best_cut) ) {
+                best_excess = excess;
+                best_cut    = cur_cut;
+                best_moves  = moves.size();
+            }
+            else if ( moves.size() - best_moves > max_stall ) {
+                break;
+            }
+        }
+
+        // Roll back the moves made after the best point of the pass
+        for ( size_t i = moves.size(); i > best_moves; i-- ) {
+            side[moves[i - 1]] ^= 1;
+        }
+
+        cut = best_cut;
+        if ( best_moves == 0 ) break;
+    }
+    return cut;
+}
+
+void
+SSTMultilevelPartition::initialBisection(
+    const Graph& graph, const double target[2], const double max_wgt[2], std::vector<uint8_t>& side)
+{
+    const uint32_t n = graph.size();
+    side.assign(n, 0);
+    if ( n == 0 ) return;
+
+    std::vector<uint8_t> trial;
+    double               best_cut    = 0.0;
+    double               best_excess = 0.0;
+    const uint32_t       tries       = std::min(n, initial_tries);
+
+    for ( uint32_t t = 0; t < tries; t++ ) {
+        growBisection(graph, rng.generateNextUInt32() % n, target, max_wgt, trial);
+        double cut = refineBisection(graph, max_wgt, trial);
+
+        double wgt[2] = { 0.0, 0.0 };
+        for ( uint32_t v = 0; v < n; v++ ) {
+            wgt[trial[v]] += graph.vwgt[v];
+        }
+        double excess = excessWeight(wgt, max_wgt);
+
+        if ( t == 0 || excess < best_excess || (excess <= best_excess && cut < best_cut) ) {
+            best_cut    = cut;
+            best_excess = excess;
+            side.swap(trial);
+        }
+    }
+}
+
+void
+SSTMultilevelPartition::bisect(const Graph& graph, double frac0, std::vector<uint8_t>& side)
+{
+    const double total     = graph.totalWeight();
+    const double target[2] = { frac0 * total, (1.0 - frac0) * total };
+
+    // Maximum weight for each side.  Coarse vertices can be heavy, so
+    // allow at least one vertex worth of imbalance above the input
+    // graph.  On the input graph, refinement will minimize any excess
+    // that can't be avoided.
+    auto max_weights = [&](const Graph& g, double max_wgt[2]) {
+        const double slack = &g == &graph ? 0.0 : g.maxVertexWeight();
+        for ( int s = 0; s < 2; s++ ) {
+            max_wgt[s] = target[s] + std::max(target[s] * bisect_tol, slack);
+        }
+    };
+
+    // Build the coarsening hierarchy.  cmaps[i] maps the vertices of
+    // level i to level i + 1, where level 0 is the input graph.
+    std::vector<std::unique_ptr<Graph>> levels;
+    std::vector<std::vector<uint32_t>>  cmaps;
+    const Graph*                        current  = &graph;
+    const double                        max_vwgt = 1.5 * total / coarsen_to;
+
+    while ( current->size() > coarsen_to ) {
+        auto                  coarse = std::make_unique<Graph>();
+        std::vector<uint32_t> cmap;
+        coarsen(*current, max_vwgt, *coarse, cmap);
+
+        // Stop once matching no longer shrinks the graph
+        if ( coarse->size() > 0.95 * current->size() ) break;
+
+        current = coarse.get();
+        levels.push_back(std::move(coarse));
+        cmaps.push_back(std::move(cmap));
+    }
+
+    double               max_wgt[2];
+    std::vector<uint8_t> coarse_side;
+    max_weights(*current, max_wgt);
+    initialBisection(*current, target, max_wgt, coarse_side);
+
+    // Project the bisection back to the input graph, refining at
+    // each level
+    for ( size_t l = levels.size(); l > 0; l-- ) {
+        const Graph&                 fine = l == 1 ? graph : *levels[l - 2];
+        const std::vector<uint32_t>& cmap = cmaps[l - 1];
+
+        std::vector<uint8_t> fine_side(fine.size());
+        for ( uint32_t v = 0; v < fine.size(); v++ ) {
+            fine_side[v] = coarse_side[cmap[v]];
+        }
+
+        max_weights(fine, max_wgt);
+        refineBisection(fine, max_wgt, fine_side);
+        coarse_side.swap(fine_side);
+    }
+
+    side.swap(coarse_side);
+}
+
+void
+SSTMultilevelPartition::recursiveBisect(const Graph& graph, const std::vector<uint32_t>& global, uint32_t first_part,
+    uint32_t nparts, std::vector<uint32_t>& part)
+{
+    const uint32_t n = graph.size();
+    if ( nparts == 1 || n == 0 ) {
+        for ( uint32_t v = 0; v < n; v++ ) {
+            part[global[v]] = first_part;
+        }
+        return;
+    }
+
+    const uint32_t       nparts0 = nparts / 2;
+    std::vector<uint8_t> side;
+    bisect(graph, static_cast<double>(nparts0) / nparts, side);
+
+    // Number the vertices within each side
+    std::vector<uint32_t> local(n);
+    uint32_t              count[2] = { 0, 0 };
+    for ( uint32_t v = 0; v < n; v++ ) {
+        local[v] = count[side[v]]++;
+    }
+
+    for ( int s = 0; s < 2; s++ ) {
+        Graph                 sub;
+        std::vector<uint32_t> sub_global;
+        sub.vwgt.reserve(count[s]);
+        sub_global.reserve(count[s]);
+        sub.xadj.push_back(0);
+
+        for ( uint32_t v = 0; v < n; v++ ) {
+            if ( side[v] != s ) continue;
+            sub.vwgt.push_back(graph.vwgt[v]);
+            sub_global.push_back(global[v]);
+            for ( size_t j = graph.xadj[v]; j < graph.xadj[v + 1]; j++ ) {
+                uint32_t u = graph.adjncy[j];
+                if ( side[u] != s ) continue;
+                sub.adjncy.push_back(local[u]);
+                sub.adjwgt.push_back(graph.adjwgt[j]);
+            }
+            sub.xadj.push_back(sub.adjncy.size());
+        }
+
+        if ( s == 0 )
+            recursiveBisect(sub, sub_global, first_part, nparts0, part);
+        else
+            recursiveBisect(sub, sub_global, first_part + nparts0, nparts - nparts0, part);
+    }
+}
+
+void
+SSTMultilevelPartition::partitionGraph(const Graph& graph, uint32_t nparts, std::vector<uint32_t>& part)
+{
+    part.assign(graph.size(), 0);
+    if ( nparts <= 1 ) return;
+
+    // Imbalance compounds over the levels of recursion, so split the
+    // tolerance between them
+    const double depth = std::ceil(std::log2(static_cast<double>(nparts)));
+    bisect_tol         = std::pow(1.0 + imbalance_tol, 1.0 / depth) - 1.0;
+
+    std::vector<uint32_t> global(graph.size());
+    std::iota(global.begin(), global.end(), 0);
+    recursiveBisect(graph, global, 0, nparts, part);
+}
+
+void
+SSTMultilevelPartition::reportPartition(
+    PartitionGraph* pgraph, const std::vector<double>& vwgt, const std::vector<uint32_t>& part)
+{
+    std::vector<double> part_wgt(total_parts, 0.0);
+    for ( size_t v = 0; v < vwgt.size(); v++ ) {
+        part_wgt[part[v]] += vwgt[v];
+    }
+    const double max_wgt = *std::max_element(part_wgt.begin(), part_wgt.end());
+    const double avg_wgt = std::accumulate(vwgt.begin(), vwgt.end(), 0.0) / total_parts;
+
+    size_t    cut_links   = 0;
+    SimTime_t min_cut_lat = MAX_SIMTIME_T;
+    size_t    link_index  = 0;
+    for ( auto& link : pgraph->getLinkMap() ) {
+        const auto& ends = link_ends[link_index++];
+        if ( ends[1] == NO_VERTEX || part[ends[0]] == part[ends[1]] ) continue;
+        cut_links++;
+        min_cut_lat = std::min(min_cut_lat, link.getMinLatency());
+    }
+
+    part_output.verbose(CALL_INFO, 1, 0, "- Cut links:                        %10zu\n", cut_links);
+    if ( cut_links > 0 ) {
+        UnitAlgebra lookahead = Simulation::getTimeLord()->getTimeBase() * min_cut_lat;
+        part_output.verbose(
+            CALL_INFO, 1, 0, "- Lookahead (min cut link latency): %10s\n", lookahead.toStringBestSI().c_str());
+    }
+    part_output.verbose(
+        CALL_INFO, 1, 0, "- Load imbalance (max/avg):         %10.3f\n", avg_wgt > 0.0 ? max_wgt / avg_wgt : 1.0);
+}
+
+void
+SSTMultilevelPartition::performPartition(PartitionGraph* pgraph)
+{
+    PartitionComponentMap_t& comps = pgraph->getComponentMap();
+
+    part_output.verbose(CALL_INFO, 1, 0, "Performing a multilevel partition scheme for simulation model.\n");
+
+    Graph graph;
+    buildGraph(pgraph, graph);
+
+    part_output.verbose(CALL_INFO, 1, 0, "- Vertex Count:                     %10" PRIu32 "\n", graph.size());
+    part_output.verbose(CALL_INFO, 1, 0, "- Edge Count:                       %10zu\n", graph.adjncy.size() / 2);
+    part_output.verbose(CALL_INFO, 1, 0, "- Part Count:                       %10" PRIu32 "\n", total_parts);
+
+    std::vector<uint32_t> part;
+    partitionGraph(graph, total_parts, part);
+
+    uint32_t index = 0;
+    for ( auto* comp : comps ) {
+        comp->rank = convertPartNum(part[index++]);
+    }
+
+    reportPartition(pgraph, graph.vwgt, part);
+    part_output.verbose(CALL_INFO, 1, 0, "Multilevel partition scheme completed.\n");
+}
+
+} // namespace SST::IMPL::Partition
@@ -0,0 +1,182 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+#define SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/model/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/rng/marsaglia.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/sstpart.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace SST::IMPL::Partition {
+
+/**
+   Multilevel graph partitioner.  The partition graph is coarsened by
+   repeatedly collapsing pairs of components joined by heavy edges,
+   the coarsest graph is bisected using greedy graph growing and the
+   bisection is then projected back through each level and refined
+   using Fiduccia-Mattheyses moves.  Bisection is applied recursively
+   until there is one part per rank/thread.
+
+   Component weights are taken from ConfigComponent::weight and edges
+   are weighted by the inverse of the link latency, so the cut will
+   preferentially fall on high latency links.  If link traffic from a
+   previous run was loaded with --partition-weights, edge weights are
+   also scaled by the number of events sent over each link.
+*/
+class SSTMultilevelPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTMultilevelPartition,
+        "sst",
+        "multilevel",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel (coarsen / bisect / Fiduccia-Mattheyses refine) partitioner which minimizes the latency weighted "
+        "edge cut while balancing component weights across ranks and threads.")
+
+protected:
+    /**
+       Weighted undirected graph in compressed sparse row format.
+       Neighbors of vertex v are adjncy[xadj[v]] to adjncy[xadj[v+1]-1].
+    */
+    struct Graph
+    {
+        std::vector<double>   vwgt;
+        std::vector<size_t>   xadj;
+        std::vector<uint32_t> adjncy;
+        std::vector<double>   adjwgt;
+
+        uint32_t size() const { return vwgt.size(); }
+        double   totalWeight() const;
+        double   maxVertexWeight() const;
+    };
+
+    /** Undirected edge used when building a Graph */
+    struct Edge
+    {
+        uint32_t u;
+        uint32_t v;
+        double   weight;
+    };
+
+    /** Number of ranks/threads in the simulation */
+    RankInfo world_size;
+    /** Total number of parts to create */
+    uint32_t total_parts;
+    /** Output object to print partitioning information */
+    Output   part_output;
+    /** Allowed fractional imbalance per part */
+    double   imbalance_tol;
+
+    /**
+       Vertices at each end of every link in the partition graph, in
+       link map order.  Links with only one end in the graph have the
+       second end set to NO_VERTEX.
+    */
+    std::vector<std::array<uint32_t, 2>> link_ends;
+
+    static constexpr uint32_t NO_VERTEX = std::numeric_limits<uint32_t>::max();
+
+    /** Constructor for derived partitioners, prefix is used for part_output */
+    SSTMultilevelPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity, const std::string& prefix);
+
+    RankInfo convertPartNum(uint32_t part_num) const
+    {
+        return RankInfo(part_num / world_size.thread, part_num % world_size.thread);
+    }
+
+    /**
+       Returns the weight to use for the given link.  By default this
+       is the measured traffic plus one, divided by the minimum link
+       latency.
+    */
+    virtual double getEdgeWeight(const PartitionLink& link);
+
+    /**
+       Returns the weight of each component in component map order.
+       If no component has a positive weight, all weights are set to
+       one so that the number of components is balanced instead.
+    */
+    void getVertexWeights(PartitionGraph* pgraph, std::vector<double>& vwgt);
+
+    /** Fills in link_ends for the partition graph */
+    void findLinkEnds(PartitionGraph* pgraph);
+
+    /**
+       Builds the CSR graph for the partition graph.  Vertices are
+       numbered in the order they appear in the component map.  Links
+       that connect the same pair of components are merged.
+    */
+    void buildGraph(PartitionGraph* pgraph, Graph& graph);
+
+    /** Builds a CSR graph from an edge list, merging duplicate edges */
+    static void buildFromEdges(std::vector<double>& vwgt, std::vector<Edge>& edges, Graph& graph);
+
+    /**
+       Recursively partitions graph into nparts parts, numbered
+       starting at first_part.  The resulting part of local vertex v is
+       written to part[global[v]].
+    */
+    void recursiveBisect(const Graph& graph, const std::vector<uint32_t>& global, uint32_t first_part,
+        uint32_t nparts, std::vector<uint32_t>& part);
+
+    /**
+       Partitions graph into the requested number of parts.  part will
+       contain the part number for each vertex.
+    */
+    void partitionGraph(const Graph& graph, uint32_t nparts, std::vector<uint32_t>& part);
+
+    /**
+       Prints the cut and balance metrics for the given partition.
+       vwgt and part are indexed by vertex in component map order.
+    */
+    void reportPartition(PartitionGraph* pgraph, const std::vector<double>& vwgt, const std::vector<uint32_t>& part);
+
+private:
+    SST::RNG::MarsagliaRNG rng;
+    double                 bisect_tol = 0.0;
+
+    void   bisect(const Graph& graph, double frac0, std::vector<uint8_t>& side);
+    void   coarsen(const Graph& graph, double max_vwgt, Graph& coarse, std::vector<uint32_t>& cmap);
+    void   initialBisection(const Graph& graph, const double target[2], const double max_wgt[2],
+          std::vector<uint8_t>& side);
+    void   growBisection(const Graph& graph, uint32_t seed, const double target[2], const double max_wgt[2],
+          std::vector<uint8_t>& side);
+    double refineBisection(const Graph& graph, const double max_wgt[2], std::vector<uint8_t>& side);
+
+public:
+    SSTMultilevelPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity);
+    ~SSTMultilevelPartition() {}
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    bool requiresConfigGraph() override { return false; }
+    bool spawnOnAllRanks() override { return false; }
+};
+
+} // namespace SST::IMPL::Partition
+
+#endif // SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
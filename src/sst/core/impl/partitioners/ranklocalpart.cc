@@ -0,0 +1,669 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/ranklocalpart.h"
+
+#include "sst/core/config.h"
+#include "sst/core/model/configGraph.h"
+#include "sst/core/objectComms.h"
+#include "sst/core/simulation.h"
+#include "sst/core/sst_mpi.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <memory>
+#include <numeric>
+#include <utility>
+
+namespace SST::IMPL::Partition {
+
+namespace {
+
+// Maximum number of rounds of boundary refinement between ranks
+constexpr int refinement_rounds = 16;
+
+// Tag used when sending slices to and from rank 0
+constexpr int slice_tag = 0;
+
+#ifdef SST_CONFIG_HAVE_MPI
+// Sends send[r] to rank r and receives the data sent to this rank
+// from all ranks, concatenated in rank order.  If counts is not null,
+// it is set to the number of elements received from each rank.
+template <typename T>
+void
+allToAll(const std::vector<std::vector<T>>& send, std::vector<T>& recv, std::vector<int>* counts = nullptr)
+{
+    const int world = send.size();
+
+    std::vector<int> send_bytes(world), send_displ(world, 0);
+    std::vector<int> recv_bytes(world), recv_displ(world, 0);
+    std::vector<T>   send_buf;
+    for ( int r = 0; r < world; r++ ) {
+        send_bytes[r] = send[r].size() * sizeof(T);
+        if ( r > 0 ) send_displ[r] = send_displ[r - 1] + send_bytes[r - 1];
+        send_buf.insert(send_buf.end(), send[r].begin(), send[r].end());
+    }
+
+    MPI_Alltoall(send_bytes.data(), 1, MPI_INT, recv_bytes.data(), 1, MPI_INT, MPI_COMM_WORLD);
+    for ( int r = 1; r < world; r++ ) {
+        recv_displ[r] = recv_displ[r - 1] + recv_bytes[r - 1];
+    }
+
+    recv.resize((recv_displ[world - 1] + recv_bytes[world - 1]) / sizeof(T));
+    MPI_Alltoallv(send_buf.data(), send_bytes.data(), send_displ.data(), MPI_BYTE, recv.data(), recv_bytes.data(),
+        recv_displ.data(), MPI_BYTE, MPI_COMM_WORLD);
+
+    if ( counts ) {
+        counts->resize(world);
+        for ( int r = 0; r < world; r++ ) {
+            (*counts)[r] = recv_bytes[r] / sizeof(T);
+        }
+    }
+}
+#endif
+
+} // anonymous namespace
+
+double
+SSTRankLocalPartition::Slice::totalWeight() const
+{
+    return std::accumulate(vwgt.begin(), vwgt.end(), 0.0);
+}
+
+SSTRankLocalPartition::SSTRankLocalPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity) :
+    SSTMultilevelPartition(total_ranks, my_rank, my_rank.rank == 0 ? verbosity : 0, "RankLocalPartition "),
+    my_rank(my_rank)
+{}
+
+void
+SSTRankLocalPartition::partitionThreads(const Slice& slice, std::vector<uint32_t>& thread)
+{
+    if ( world_size.thread == 1 || slice.size() == 0 ) {
+        thread.assign(slice.size(), 0);
+        return;
+    }
+
+    std::unordered_map<uint32_t, uint32_t> local;
+    for ( uint32_t i = 0; i < slice.size(); i++ ) {
+        local[slice.vertices[i]] = i;
+    }
+
+    // Each edge is stored on both of its vertices, so only add it from
+    // the lower numbered end
+    std::vector<Edge> edges;
+    for ( uint32_t i = 0; i < slice.size(); i++ ) {
+        for ( size_t e = slice.xadj[i]; e < slice.xadj[i + 1]; e++ ) {
+            auto it = local.find(slice.adjncy[e]);
+            if ( it == local.end() || it->second <= i ) continue;
+            edges.push_back({ i, it->second, slice.adjwgt[e] });
+        }
+    }
+
+    std::vector<double> vwgt = slice.vwgt;
+    Graph               graph;
+    buildFromEdges(vwgt, edges, graph);
+    partitionGraph(graph, world_size.thread, thread);
+}
+
+void
+SSTRankLocalPartition::partitionLocal(PartitionGraph* pgraph)
+{
+    PartitionComponentMap_t& comps = pgraph->getComponentMap();
+
+    part_output.verbose(CALL_INFO, 1, 0, "Performing a rank local partition scheme for simulation model.\n");
+
+    // Links to components on other ranks are left out of the graph
+    Graph graph;
+    buildGraph(pgraph, graph);
+
+    std::vector<uint32_t> thread(graph.size(), 0);
+    if ( graph.size() > 0 ) partitionGraph(graph, world_size.thread, thread);
+
+    std::vector<double> thread_wgt(world_size.thread, 0.0);
+    uint32_t            index = 0;
+    for ( auto* comp : comps ) {
+        comp->rank = RankInfo(my_rank.rank, thread[index]);
+        thread_wgt[thread[index]] += graph.vwgt[index];
+        index++;
+    }
+
+    const double avg_wgt = graph.totalWeight() / total_parts;
+    const double max_wgt = *std::max_element(thread_wgt.begin(), thread_wgt.end());
+    part_output.verbose(CALL_INFO, 1, 0, "- Vertex Count:                     %10" PRIu32 "\n", graph.size());
+    part_output.verbose(CALL_INFO, 1, 0, "- Part Count:                       %10" PRIu32 "\n", total_parts);
+    part_output.verbose(
+        CALL_INFO, 1, 0, "- Load imbalance (max/avg):         %10.3f\n", avg_wgt > 0.0 ? max_wgt / avg_wgt : 1.0);
+    part_output.verbose(CALL_INFO, 1, 0, "Rank local partition scheme completed.\n");
+}
+
+#ifdef SST_CONFIG_HAVE_MPI
+void
+SSTRankLocalPartition::scatterSlices(PartitionGraph* pgraph, std::vector<double>& vwgt, Slice& slice)
+{
+    if ( my_rank.rank != 0 ) {
+        Comms::recv(0, slice_tag, slice.vertices);
+        Comms::recv(0, slice_tag, slice.vwgt);
+        Comms::recv(0, slice_tag, slice.xadj);
+        Comms::recv(0, slice_tag, slice.adjncy);
+        Comms::recv(0, slice_tag, slice.adjwgt);
+        return;
+    }
+
+    getVertexWeights(pgraph, vwgt);
+    findLinkEnds(pgraph);
+
+    std::vector<Edge> edges;
+    edges.reserve(link_ends.size());
+    size_t link_index = 0;
+    for ( auto& link : pgraph->getLinkMap() ) {
+        const auto& ends = link_ends[link_index++];
+        if ( ends[1] == NO_VERTEX ) continue;
+        edges.push_back({ ends[0], ends[1], getEdgeWeight(link) });
+    }
+
+    std::vector<double> graph_vwgt = vwgt;
+    Graph               graph;
+    buildFromEdges(graph_vwgt, edges, graph);
+
+    // Split the vertices into contiguous blocks of equal weight.
+    // Models are usually built in an order that keeps connected
+    // components close together, so this is a reasonable start.
+    const double total = graph.totalWeight();
+    double       accum = 0.0;
+
+    std::vector<uint32_t> block_start(world_size.rank + 1, graph.size());
+    block_start[0] = 0;
+    uint32_t rank  = 0;
+    for ( uint32_t v = 0; v < graph.size(); v++ ) {
+        const uint32_t owner = std::min<uint32_t>(
+            world_size.rank - 1, static_cast<uint32_t>((accum + graph.vwgt[v] / 2.0) / total * world_size.rank));
+        while ( rank < owner ) {
+            block_start[++rank] = v;
+        }
+        accum += graph.vwgt[v];
+    }
+
+    for ( int r = world_size.rank - 1; r >= 0; r-- ) {
+        const uint32_t begin = block_start[r];
+        const uint32_t end   = block_start[r + 1];
+
+        Slice block;
+        block.vertices.resize(end - begin);
+        std::iota(block.vertices.begin(), block.vertices.end(), begin);
+        block.vwgt.assign(graph.vwgt.begin() + begin, graph.vwgt.begin() + end);
+        block.xadj.assign(graph.xadj.begin() + begin, graph.xadj.begin() + end + 1);
+        for ( auto& x : block.xadj ) {
+            x -= graph.xadj[begin];
+        }
+        block.adjncy.assign(graph.adjncy.begin() + graph.xadj[begin], graph.adjncy.begin() + graph.xadj[end]);
+        block.adjwgt.assign(graph.adjwgt.begin() + graph.xadj[begin], graph.adjwgt.begin() + graph.xadj[end]);
+
+        if ( r == 0 ) {
+            slice = std::move(block);
+        }
+        else {
+            Comms::send(r, slice_tag, block.vertices);
+            Comms::send(r, slice_tag, block.vwgt);
+            Comms::send(r, slice_tag, block.xadj);
+            Comms::send(r, slice_tag, block.adjncy);
+            Comms::send(r, slice_tag, block.adjwgt);
+        }
+    }
+}
+
+void
+SSTRankLocalPartition::buildLoadedSlice(ConfigGraph* graph, PartitionGraph* pgraph, uint32_t first_vertex, Slice& slice)
+{
+    PartitionComponentMap_t& pcomps = pgraph->getComponentMap();
+    ConfigLinkMap_t&         links  = graph->getLinkMap();
+
+    struct RemoteEnd
+    {
+        const std::string* name;
+        uint32_t           vertex;
+        double             weight;
+    };
+
+    // Neighbors of each local vertex.  Links to other ranks are
+    // collected by remote rank and filled in once the vertex numbers
+    // on the other side are known.
+    std::vector<std::vector<std::pair<uint32_t, double>>> adj(pcomps.size());
+    std::vector<std::vector<RemoteEnd>>                   remote(world_size.rank);
+    findLinkEnds(pgraph);
+    size_t link_index = 0;
+    for ( auto& plink : pgraph->getLinkMap() ) {
+        const auto&       ends = link_ends[link_index++];
+        const ConfigLink* link = links[plink.id_];
+        if ( link->nonlocal_ ) {
+            // latency_[1] holds the remote thread, so only the local
+            // latency is used
+            const SimTime_t latency = plink.latency_[0];
+            remote[plink.component_[1]].push_back(
+                { &link->name_, ends[0], (1.0 + plink.traffic_) / (latency == 0 ? 1 : latency) });
+            continue;
+        }
+        if ( ends[1] == NO_VERTEX ) continue;
+        const double weight = getEdgeWeight(plink);
+        adj[ends[0]].emplace_back(first_vertex + ends[1], weight);
+        adj[ends[1]].emplace_back(first_vertex + ends[0], weight);
+    }
+
+    // Both ranks list the links between them in name order, so the
+    // vertex numbers sent for them line up
+    std::vector<std::vector<uint32_t>> send(world_size.rank);
+    for ( uint32_t r = 0; r < world_size.rank; r++ ) {
+        std::sort(remote[r].begin(), remote[r].end(),
+            [](const RemoteEnd& lhs, const RemoteEnd& rhs) { return *lhs.name < *rhs.name; });
+        for ( auto& end : remote[r] ) {
+            send[r].push_back(first_vertex + end.vertex);
+        }
+    }
+
+    std::vector<uint32_t> recv;
+    std::vector<int>      counts;
+    allToAll(send, recv, &counts);
+
+    size_t index = 0;
+    for ( uint32_t r = 0; r < world_size.rank; r++ ) {
+        if ( static_cast<size_t>(counts[r]) != remote[r].size() ) {
+            part_output.fatal(CALL_INFO, 1,
+                "ERROR: Rank %" PRIu32 " has %zu links to rank %" PRIu32 ", but rank %" PRIu32
+                " has %d links to rank %" PRIu32 "\n",
+                my_rank.rank, remote[r].size(), r, r, counts[r], my_rank.rank);
+        }
+        for ( auto& end : remote[r] ) {
+            adj[end.vertex].emplace_back(recv[index++], end.weight);
+        }
+    }
+
+    getVertexWeights(pgraph, slice.vwgt);
+    slice.vertices.resize(pcomps.size());
+    std::iota(slice.vertices.begin(), slice.vertices.end(), first_vertex);
+    slice.xadj.assign(1, 0);
+    for ( auto& neighbors : adj ) {
+        for ( auto& [vertex, weight] : neighbors ) {
+            slice.adjncy.push_back(vertex);
+            slice.adjwgt.push_back(weight);
+        }
+        slice.xadj.push_back(slice.adjncy.size());
+    }
+}
+
+void
+SSTRankLocalPartition::registerOwners(const std::vector<uint32_t>& vertices)
+{
+    std::vector<std::vector<uint32_t>> send(world_size.rank);
+    for ( uint32_t v : vertices ) {
+        send[v % world_size.rank].push_back(v);
+    }
+
+    std::vector<uint32_t> recv;
+    std::vector<int>      counts;
+    allToAll(send, recv, &counts);
+
+    size_t index = 0;
+    for ( uint32_t r = 0; r < world_size.rank; r++ ) {
+        for ( int i = 0; i < counts[r]; i++ ) {
+            directory[recv[index++]] = r;
+        }
+    }
+}
+
+void
+SSTRankLocalPartition::findGhostOwners(const Slice& slice, const std::unordered_map<uint32_t, uint32_t>& local,
+    std::unordered_map<uint32_t, uint32_t>& ghost_owner)
+{
+    // Ask the directory for the owner of each ghost
+    std::vector<std::vector<uint32_t>> request(world_size.rank);
+    ghost_owner.clear();
+    for ( uint32_t u : slice.adjncy ) {
+        if ( local.count(u) || ghost_owner.count(u) ) continue;
+        ghost_owner[u] = 0;
+        request[u % world_size.rank].push_back(u);
+    }
+
+    std::vector<uint32_t> recv;
+    std::vector<int>      counts;
+    allToAll(request, recv, &counts);
+
+    std::vector<std::vector<uint32_t>> reply(world_size.rank);
+    size_t                             index = 0;
+    for ( uint32_t r = 0; r < world_size.rank; r++ ) {
+        for ( int i = 0; i < counts[r]; i++ ) {
+            reply[r].push_back(directory.at(recv[index++]));
+        }
+    }
+
+    // Replies come back in the same order as the requests
+    allToAll(reply, recv);
+    index = 0;
+    for ( uint32_t r = 0; r < world_size.rank; r++ ) {
+        for ( uint32_t u : request[r] ) {
+            ghost_owner[u] = recv[index++];
+        }
+    }
+}
+
+uint64_t
+SSTRankLocalPartition::refineSlices(Slice& slice)
+{
+    const uint32_t nranks = world_size.rank;
+    const uint32_t me     = my_rank.rank;
+
+    struct Move
+    {
+        double   gain;
+        uint32_t index;
+        uint32_t dest;
+    };
+
+    uint64_t total_moved = 0;
+    for ( int round = 0; round < refinement_rounds; round++ ) {
+        std::unordered_map<uint32_t, uint32_t> local;
+        for ( uint32_t i = 0; i < slice.size(); i++ ) {
+            local[slice.vertices[i]] = i;
+        }
+
+        std::unordered_map<uint32_t, uint32_t> ghost_owner;
+        findGhostOwners(slice, local, ghost_owner);
+
+        double              my_load = slice.totalWeight();
+        std::vector<double> load(nranks);
+        SST_MPI_Allgather(&my_load, 1, MPI_DOUBLE, load.data(), 1, MPI_DOUBLE, MPI_COMM_WORLD);
+
+        const double avg_load   = std::accumulate(load.begin(), load.end(), 0.0) / nranks;
+        const double max_load   = avg_load * (1.0 + imbalance_tol);
+        const bool   overloaded = load[me] > max_load;
+
+        // Find the best move for each boundary vertex.  Vertices only
+        // move to higher ranks on even rounds and lower ranks on odd
+        // rounds so that neighboring vertices on two ranks don't swap
+        // places.  Moves must improve the cut, unless the rank is
+        // overloaded and the destination is underloaded.
+        const bool upward = round % 2 == 0;
+
+        std::vector<Move>                        moves;
+        std::vector<std::pair<uint32_t, double>> conn;
+        for ( uint32_t i = 0; i < slice.size(); i++ ) {
+            conn.clear();
+            double internal = 0.0;
+            for ( size_t e = slice.xadj[i]; e < slice.xadj[i + 1]; e++ ) {
+                const uint32_t u     = slice.adjncy[e];
+                const uint32_t owner = local.count(u) ? me : ghost_owner[u];
+                if ( owner == me ) {
+                    internal += slice.adjwgt[e];
+                    continue;
+                }
+                auto it = std::find_if(conn.begin(), conn.end(), [owner](auto& c) { return c.first == owner; });
+                if ( it == conn.end() )
+                    conn.emplace_back(owner, slice.adjwgt[e]);
+                else
+                    it->second += slice.adjwgt[e];
+            }
+
+            Move best = { 0.0, i, me };
+            for ( auto& [rank, weight] : conn ) {
+                if ( upward ? rank < me : rank > me ) continue;
+                const double gain = weight - internal;
+                if ( gain <= 0.0 && !(overloaded && load[rank] < avg_load) ) continue;
+                if ( best.dest == me || gain > best.gain ) best = { gain, i, rank };
+            }
+            if ( best.dest != me ) moves.push_back(best);
+        }
+
+        std::vector<double> proposed(nranks, 0.0);
+        for ( auto& move : moves ) {
+            proposed[move.dest] += slice.vwgt[move.index];
+        }
+        std::vector<double> all_proposed(nranks * nranks);
+        SST_MPI_Allgather(
+            proposed.data(), nranks, MPI_DOUBLE, all_proposed.data(), nranks, MPI_DOUBLE, MPI_COMM_WORLD);
+
+        // Each rank can accept vertices up to the maximum load, plus
+        // whatever it sends on.  Every rank has all the proposals, so
+        // they all compute the same quotas.  Ranks are visited starting
+        // from the end that only receives this round so that the
+        // weight each rank sends is known before it is visited.  The
+        // space on each rank is shared between the senders in
+        // proportion to how much they want to send.
+        std::vector<double> sent(nranks, 0.0);
+        std::vector<double> quota(nranks, 0.0);
+        for ( uint32_t n = 0; n < nranks; n++ ) {
+            const uint32_t r         = upward ? nranks - 1 - n : n;
+            double         requested = 0.0;
+            for ( uint32_t s = 0; s < nranks; s++ ) {
+                requested += all_proposed[s * nranks + r];
+            }
+            if ( requested <= 0.0 ) continue;
+
+            const double space    = std::max(0.0, max_load - load[r] + sent[r]);
+            const double fraction = std::min(1.0, space / requested);
+            for ( uint32_t s = 0; s < nranks; s++ ) {
+                sent[s] += all_proposed[s * nranks + r] * fraction;
+            }
+            quota[r] = proposed[r] * fraction;
+        }
+
+        std::sort(moves.begin(), moves.end(), [](const Move& lhs, const Move& rhs) {
+            return lhs.gain > rhs.gain || (lhs.gain == rhs.gain && lhs.index < rhs.index);
+        });
+
+        std::vector<uint32_t> dest(slice.size(), me);
+        for ( auto& move : moves ) {
+            const double weight = slice.vwgt[move.index];
+            if ( weight > quota[move.dest] ) continue;
+            quota[move.dest] -= weight;
+            dest[move.index] = move.dest;
+        }
+
+        // Send the moved vertices along with their edges.  Each vertex
+        // is sent as its id and degree followed by its neighbors, and
+        // its weight followed by its edge weights.
+        std::vector<std::vector<uint32_t>> send_ids(nranks);
+        std::vector<std::vector<double>>   send_wgts(nranks);
+        Slice                              kept;
+        kept.xadj.push_back(0);
+        uint64_t moved = 0;
+        for ( uint32_t i = 0; i < slice.size(); i++ ) {
+            const size_t begin = slice.xadj[i];
+            const size_t end   = slice.xadj[i + 1];
+            if ( dest[i] == me ) {
+                kept.vertices.push_back(slice.vertices[i]);
+                kept.vwgt.push_back(slice.vwgt[i]);
+                kept.adjncy.insert(kept.adjncy.end(), slice.adjncy.begin() + begin, slice.adjncy.begin() + end);
+                kept.adjwgt.insert(kept.adjwgt.end(), slice.adjwgt.begin() + begin, slice.adjwgt.begin() + end);
+                kept.xadj.push_back(kept.adjncy.size());
+                continue;
+            }
+            auto& ids  = send_ids[dest[i]];
+            auto& wgts = send_wgts[dest[i]];
+            ids.push_back(slice.vertices[i]);
+            ids.push_back(end - begin);
+            ids.insert(ids.end(), slice.adjncy.begin() + begin, slice.adjncy.begin() + end);
+            wgts.push_back(slice.vwgt[i]);
+            wgts.insert(wgts.end(), slice.adjwgt.begin() + begin, slice.adjwgt.begin() + end);
+            moved++;
+        }
+
+        std::vector<uint32_t> recv_ids;
+        std::vector<double>   recv_wgts;
+        allToAll(send_ids, recv_ids);
+        allToAll(send_wgts, recv_wgts);
+
+        std::vector<uint32_t> received;
+        for ( size_t id_pos = 0, wgt_pos = 0; id_pos < recv_ids.size(); ) {
+            const uint32_t vertex = recv_ids[id_pos++];
+            const uint32_t degree = recv_ids[id_pos++];
+            received.push_back(vertex);
+            kept.vertices.push_back(vertex);
+            kept.vwgt.push_back(recv_wgts[wgt_pos++]);
+            kept.adjncy.insert(kept.adjncy.end(), recv_ids.begin() + id_pos, recv_ids.begin() + id_pos + degree);
+            kept.adjwgt.insert(kept.adjwgt.end(), recv_wgts.begin() + wgt_pos, recv_wgts.begin() + wgt_pos + degree);
+            kept.xadj.push_back(kept.adjncy.size());
+            id_pos += degree;
+            wgt_pos += degree;
+        }
+        slice = std::move(kept);
+        registerOwners(received);
+
+        uint64_t global_moved = 0;
+        SST_MPI_Allreduce(&moved, &global_moved, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+        total_moved += global_moved;
+        if ( global_moved == 0 ) break;
+    }
+    return total_moved;
+}
+#endif
+
+void
+SSTRankLocalPartition::performPartition(PartitionGraph* pgraph)
+{
+    if ( world_size.rank == 1 ) {
+        partitionLocal(pgraph);
+        return;
+    }
+
+#ifdef SST_CONFIG_HAVE_MPI
+    part_output.verbose(CALL_INFO, 1, 0, "Performing a rank local partition scheme for simulation model.\n");
+
+    std::vector<double> vwgt;
+    Slice               slice;
+    scatterSlices(pgraph, vwgt, slice);
+    registerOwners(slice.vertices);
+
+    const uint64_t moved = refineSlices(slice);
+
+    std::vector<uint32_t> thread;
+    partitionThreads(slice, thread);
+
+    // Send the final assignment back to rank 0 as (vertex, thread)
+    // pairs
+    std::vector<uint32_t> assignment;
+    assignment.reserve(slice.size() * 2);
+    for ( uint32_t i = 0; i < slice.size(); i++ ) {
+        assignment.push_back(slice.vertices[i]);
+        assignment.push_back(thread[i]);
+    }
+
+    if ( my_rank.rank != 0 ) {
+        Comms::send(0, slice_tag, assignment);
+        return;
+    }
+
+    std::vector<uint32_t> part(vwgt.size());
+    for ( uint32_t r = 0; r < world_size.rank; r++ ) {
+        if ( r != 0 ) Comms::recv(r, slice_tag, assignment);
+        for ( size_t i = 0; i < assignment.size(); i += 2 ) {
+            part[assignment[i]] = r * world_size.thread + assignment[i + 1];
+        }
+    }
+
+    uint32_t index = 0;
+    for ( auto* comp : pgraph->getComponentMap() ) {
+        comp->rank = convertPartNum(part[index++]);
+    }
+
+    part_output.verbose(CALL_INFO, 1, 0, "- Vertex Count:                     %10zu\n", vwgt.size());
+    part_output.verbose(CALL_INFO, 1, 0, "- Part Count:                       %10" PRIu32 "\n", total_parts);
+    part_output.verbose(CALL_INFO, 1, 0, "- Vertices moved by refinement:     %10" PRIu64 "\n", moved);
+    reportPartition(pgraph, vwgt, part);
+    part_output.verbose(CALL_INFO, 1, 0, "Rank local partition scheme completed.\n");
+#endif
+}
+
+void
+SSTRankLocalPartition::performPartition(ConfigGraph* graph)
+{
+    std::unique_ptr<PartitionGraph> pgraph(graph->getCollapsedPartitionGraph());
+    if ( world_size.rank == 1 ) {
+        partitionLocal(pgraph.get());
+        graph->annotateRanks(pgraph.get());
+        return;
+    }
+
+#ifdef SST_CONFIG_HAVE_MPI
+    part_output.verbose(CALL_INFO, 1, 0, "Performing a rank local partition scheme for simulation model.\n");
+
+    // Vertices are numbered in rank order.  first_vertex[r] is the
+    // first vertex loaded on rank r.
+    const uint32_t        nranks      = world_size.rank;
+    uint32_t              local_count = pgraph->getComponentMap().size();
+    std::vector<uint32_t> first_vertex(nranks + 1, 0);
+    SST_MPI_Allgather(&local_count, 1, MPI_UINT32_T, first_vertex.data() + 1, 1, MPI_UINT32_T, MPI_COMM_WORLD);
+    std::partial_sum(first_vertex.begin(), first_vertex.end(), first_vertex.begin());
+
+    Slice slice;
+    buildLoadedSlice(graph, pgraph.get(), first_vertex[my_rank.rank], slice);
+    registerOwners(slice.vertices);
+
+    const uint64_t moved = refineSlices(slice);
+
+    std::vector<uint32_t> thread;
+    partitionThreads(slice, thread);
+
+    // Send the final assignment back to the rank each vertex was
+    // loaded on as (vertex, thread) pairs
+    std::vector<std::vector<uint32_t>> send(nranks);
+    std::vector<double>                thread_wgt(world_size.thread, 0.0);
+    for ( uint32_t i = 0; i < slice.size(); i++ ) {
+        const uint32_t v = slice.vertices[i];
+        const uint32_t origin =
+            std::upper_bound(first_vertex.begin(), first_vertex.end(), v) - first_vertex.begin() - 1;
+        send[origin].push_back(v);
+        send[origin].push_back(thread[i]);
+        thread_wgt[thread[i]] += slice.vwgt[i];
+    }
+
+    std::vector<uint32_t> recv;
+    std::vector<int>      counts;
+    allToAll(send, recv, &counts);
+
+    PartitionComponentMap_t& pcomps = pgraph->getComponentMap();
+    size_t                   index  = 0;
+    for ( uint32_t r = 0; r < nranks; r++ ) {
+        for ( int i = 0; i < counts[r]; i += 2 ) {
+            pcomps[recv[index] - first_vertex[my_rank.rank]]->rank = RankInfo(r, recv[index + 1]);
+            index += 2;
+        }
+    }
+    graph->annotateRanks(pgraph.get());
+    pgraph.reset();
+
+    graph->redistributeComponents(my_rank.rank, nranks);
+
+    double local_wgt  = slice.totalWeight();
+    double local_max  = *std::max_element(thread_wgt.begin(), thread_wgt.end());
+    double global_wgt = 0.0;
+    double global_max = 0.0;
+    SST_MPI_Allreduce(&local_wgt, &global_wgt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SST_MPI_Allreduce(&local_max, &global_max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+    const double avg_wgt = global_wgt / total_parts;
+    part_output.verbose(CALL_INFO, 1, 0, "- Vertex Count:                     %10" PRIu32 "\n", first_vertex[nranks]);
+    part_output.verbose(CALL_INFO, 1, 0, "- Part Count:                       %10" PRIu32 "\n", total_parts);
+    part_output.verbose(CALL_INFO, 1, 0, "- Vertices moved by refinement:     %10" PRIu64 "\n", moved);
+    part_output.verbose(
+        CALL_INFO, 1, 0, "- Load imbalance (max/avg):         %10.3f\n", avg_wgt > 0.0 ? global_max / avg_wgt : 1.0);
+    part_output.verbose(CALL_INFO, 1, 0, "Rank local partition scheme completed.\n");
+#endif
+}
+
+bool
+SSTRankLocalPartition::requiresConfigGraph()
+{
+    // With parallel load, components are moved between ranks, which
+    // needs the ConfigGraph
+    return Simulation::config.parallel_load();
+}
+
+} // namespace SST::IMPL::Partition
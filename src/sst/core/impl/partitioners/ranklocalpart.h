@@ -0,0 +1,156 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_RANKLOCALPART_H
+#define SST_CORE_IMPL_PARTITONERS_RANKLOCALPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/impl/partitioners/multilevelpart.h"
+#include "sst/core/model/configGraph.h"
+#include "sst/core/sst_types.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace SST::IMPL::Partition {
+
+/**
+   Partitioner that assigns components to threads on the rank that
+   runs them.  Rank 0 still builds the whole partition graph and
+   splits it into equal weight blocks of components in model order,
+   one per rank.  The ranks then improve the cut between the blocks by
+   moving boundary components to the neighboring rank they are most
+   connected to, and each rank partitions its own block across its
+   threads with the multilevel partitioner.  Rank 0 collects the
+   result.  Since rank 0 builds the whole graph, this does not reduce
+   the memory needed on rank 0.
+
+   With --parallel-load, each rank starts from the components the
+   model loaded on it and no rank builds the whole graph.  Component
+   IDs are only unique on each rank, so the ends of links between
+   ranks are matched up by link name.  The blocks are refined the same
+   way, and the configuration of every component that moved is then
+   sent to its new rank.
+*/
+class SSTRankLocalPartition : public SSTMultilevelPartition
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTRankLocalPartition,
+        "sst",
+        "ranklocal",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Partitions each rank's components across its threads on that rank.  Rank 0 splits the graph into blocks "
+        "for the ranks, which the ranks refine together by exchanging boundary components.  Supports "
+        "--parallel-load, where the blocks loaded by the model are refined without building the whole graph on "
+        "any rank.")
+
+protected:
+    /**
+       Components owned by a rank while the blocks are refined.
+       Components are identified by their vertex index in the full
+       partition graph and neighbors of vertices[i] are adjncy[xadj[i]]
+       to adjncy[xadj[i+1]-1].
+    */
+    struct Slice
+    {
+        std::vector<uint32_t> vertices;
+        std::vector<double>   vwgt;
+        std::vector<size_t>   xadj;
+        std::vector<uint32_t> adjncy;
+        std::vector<double>   adjwgt;
+
+        uint32_t size() const { return vertices.size(); }
+        double   totalWeight() const;
+    };
+
+    RankInfo my_rank;
+
+    /**
+       Partitions the vertices of slice across the threads of this
+       rank.  Only edges between vertices in the slice are considered.
+    */
+    void partitionThreads(const Slice& slice, std::vector<uint32_t>& thread);
+
+    /**
+       Partitions the components of pgraph across the threads of this
+       rank.  Used for single rank jobs.
+    */
+    void partitionLocal(PartitionGraph* pgraph);
+
+    /**
+       Builds the slice for the components this rank loaded with
+       --parallel-load.  Vertices are numbered first_vertex and up in
+       component map order.  Vertices on other ranks are found by
+       exchanging the vertex numbers at each end of the nonlocal links.
+    */
+    void buildLoadedSlice(ConfigGraph* graph, PartitionGraph* pgraph, uint32_t first_vertex, Slice& slice);
+
+    /**
+       Builds the initial block partition on rank 0 and sends each rank
+       its slice.  vwgt is filled in with the vertex weights on rank 0.
+    */
+    void scatterSlices(PartitionGraph* pgraph, std::vector<double>& vwgt, Slice& slice);
+
+    /**
+       Moves boundary vertices between ranks to reduce the cut while
+       keeping the rank loads balanced.  Returns the number of vertices
+       moved.
+    */
+    uint64_t refineSlices(Slice& slice);
+
+    /**
+       Looks up the current owner of each neighbor of the slice that
+       is not in the slice.  local maps the vertices in the slice to
+       their index.
+    */
+    void findGhostOwners(const Slice& slice, const std::unordered_map<uint32_t, uint32_t>& local,
+        std::unordered_map<uint32_t, uint32_t>& ghost_owner);
+
+    /** Records the new owners of vertices in the owner directory */
+    void registerOwners(const std::vector<uint32_t>& vertices);
+
+    /**
+       Owners of the vertices assigned to this rank's part of the owner
+       directory, which is spread across the ranks and holds vertex v
+       on rank v % world_size.rank
+    */
+    std::unordered_map<uint32_t, uint32_t> directory;
+
+public:
+    SSTRankLocalPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity);
+    ~SSTRankLocalPartition() {}
+
+    /**
+       Performs a partition of an SST simulation configuration.  This
+       is called on every rank, but only rank 0 has the graph.
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    /**
+       Performs a partition with --parallel-load.  This is called on
+       every rank with the components loaded on that rank, and moves
+       components between ranks.
+       \param graph The part of the simulation configuration on this rank
+    */
+    void performPartition(ConfigGraph* graph) override;
+
+    bool requiresConfigGraph() override;
+    bool spawnOnAllRanks() override { return true; }
+    bool supportsPartialPartitionInput() override { return true; }
+};
+
+} // namespace SST::IMPL::Partition
+
+#endif // SST_CORE_IMPL_PARTITONERS_RANKLOCALPART_H
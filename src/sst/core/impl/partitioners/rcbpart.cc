@@ -0,0 +1,265 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/rcbpart.h"
+
+#include "sst/core/model/configComponent.h"
+#include "sst/core/model/configGraph.h"
+#include "sst/core/model/configLink.h"
+#include "sst/core/simulation.h"
+#include "sst/core/timeLord.h"
+#include "sst/core/unitAlgebra.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <memory>
+#include <numeric>
+
+namespace SST::IMPL::Partition {
+
+namespace {
+
+// Number of power iterations used to find the principal axis
+constexpr int power_iterations = 32;
+
+} // anonymous namespace
+
+SSTCoordinateBisectionPartition::SSTCoordinateBisectionPartition(
+    RankInfo total_ranks, RankInfo my_rank, int verbosity) :
+    SSTCoordinateBisectionPartition(
+        total_ranks, my_rank, verbosity, "CoordinateBisectionPartition ", "a coordinate bisection")
+{}
+
+SSTCoordinateBisectionPartition::SSTCoordinateBisectionPartition(RankInfo total_ranks, RankInfo UNUSED(my_rank),
+    int verbosity, const std::string& prefix, const std::string& scheme) :
+    SSTPartitioner(),
+    world_size(total_ranks),
+    total_parts(total_ranks.rank * total_ranks.thread),
+    part_output(prefix, verbosity, 0, Output::STDOUT),
+    scheme(scheme)
+{}
+
+std::array<double, 3>
+SSTCoordinateBisectionPartition::getCutDirection(
+    std::vector<Point>::const_iterator begin, std::vector<Point>::const_iterator end)
+{
+    std::array<double, 3> lo = begin->x;
+    std::array<double, 3> hi = begin->x;
+    for ( auto it = begin; it != end; ++it ) {
+        for ( int d = 0; d < 3; d++ ) {
+            lo[d] = std::min(lo[d], it->x[d]);
+            hi[d] = std::max(hi[d], it->x[d]);
+        }
+    }
+
+    int axis = 0;
+    for ( int d = 1; d < 3; d++ ) {
+        if ( hi[d] - lo[d] > hi[axis] - lo[axis] ) axis = d;
+    }
+
+    std::array<double, 3> dir = { 0.0, 0.0, 0.0 };
+    dir[axis]                 = 1.0;
+    return dir;
+}
+
+void
+SSTCoordinateBisectionPartition::recursiveBisect(std::vector<Point>::iterator begin, std::vector<Point>::iterator end,
+    uint32_t first_part, uint32_t nparts, std::vector<uint32_t>& part)
+{
+    if ( nparts == 1 || begin == end ) {
+        for ( auto it = begin; it != end; ++it ) {
+            part[it->index] = first_part;
+        }
+        return;
+    }
+
+    // Sort the points along the cut direction.  Ties are broken by
+    // index so that the result doesn't depend on the sort
+    // implementation.
+    const std::array<double, 3> dir = getCutDirection(begin, end);
+    double                      total = 0.0;
+    for ( auto it = begin; it != end; ++it ) {
+        it->key = it->x[0] * dir[0] + it->x[1] * dir[1] + it->x[2] * dir[2];
+        total += it->weight;
+    }
+    std::sort(begin, end, [](const Point& lhs, const Point& rhs) {
+        return lhs.key < rhs.key || (lhs.key == rhs.key && lhs.index < rhs.index);
+    });
+
+    // Split at the point where the weight on the first side is closest
+    // to its share of the total
+    const uint32_t nparts0 = nparts / 2;
+    const double   target  = total * nparts0 / nparts;
+
+    auto   split = begin;
+    double wgt0  = 0.0;
+    while ( split != end && wgt0 + split->weight / 2.0 <= target ) {
+        wgt0 += split->weight;
+        ++split;
+    }
+
+    // Give each side at least one point when possible
+    if ( split == begin && std::distance(begin, end) > 1 ) ++split;
+    if ( split == end && std::distance(begin, end) > 1 ) --split;
+
+    recursiveBisect(begin, split, first_part, nparts0, part);
+    recursiveBisect(split, end, first_part + nparts0, nparts - nparts0, part);
+}
+
+void
+SSTCoordinateBisectionPartition::reportPartition(ConfigGraph* graph, const std::vector<double>& part_wgt)
+{
+    ConfigComponentMap_t& comps = graph->getComponentMap();
+
+    size_t    cut_links   = 0;
+    SimTime_t min_cut_lat = MAX_SIMTIME_T;
+    for ( ConfigLink* link : graph->getLinkMap() ) {
+        const RankInfo& rank0 = comps[COMPONENT_ID_MASK(link->component_[0])]->rank;
+        const RankInfo& rank1 = comps[COMPONENT_ID_MASK(link->component_[1])]->rank;
+        if ( rank0 == rank1 ) continue;
+        cut_links++;
+        min_cut_lat = std::min(min_cut_lat, link->getMinLatency());
+    }
+
+    const double max_wgt = *std::max_element(part_wgt.begin(), part_wgt.end());
+    const double avg_wgt = std::accumulate(part_wgt.begin(), part_wgt.end(), 0.0) / total_parts;
+
+    part_output.verbose(CALL_INFO, 1, 0, "- Cut links:                        %10zu\n", cut_links);
+    if ( cut_links > 0 ) {
+        UnitAlgebra lookahead = Simulation::getTimeLord()->getTimeBase() * min_cut_lat;
+        part_output.verbose(
+            CALL_INFO, 1, 0, "- Lookahead (min cut link latency): %10s\n", lookahead.toStringBestSI().c_str());
+    }
+    part_output.verbose(
+        CALL_INFO, 1, 0, "- Load imbalance (max/avg):         %10.3f\n", avg_wgt > 0.0 ? max_wgt / avg_wgt : 1.0);
+}
+
+void
+SSTCoordinateBisectionPartition::performPartition(ConfigGraph* graph)
+{
+    part_output.verbose(CALL_INFO, 1, 0, "Performing %s partition scheme for simulation model.\n", scheme.c_str());
+
+    // Collapse no-cut groups so that they end up on the same rank
+    std::unique_ptr<PartitionGraph> pgraph(graph->getCollapsedPartitionGraph());
+    PartitionComponentMap_t&        pcomps = pgraph->getComponentMap();
+    ConfigComponentMap_t&           comps  = graph->getComponentMap();
+
+    // Each group is placed at the average position of its components
+    std::vector<Point> points;
+    points.reserve(pcomps.size());
+    bool have_coords = false;
+    for ( auto* pcomp : pcomps ) {
+        Point point = { { 0.0, 0.0, 0.0 }, pcomp->weight, 0.0, static_cast<uint32_t>(points.size()) };
+        for ( ComponentId_t id : pcomp->group ) {
+            const std::vector<double>& coords = comps[id]->coords;
+            for ( size_t d = 0; d < 3 && d < coords.size(); d++ ) {
+                point.x[d] += coords[d];
+            }
+        }
+        for ( int d = 0; d < 3; d++ ) {
+            point.x[d] /= pcomp->group.size();
+            if ( point.x[d] != 0.0 ) have_coords = true;
+        }
+        points.push_back(point);
+    }
+
+    // If no weights were assigned, balance on number of components
+    if ( std::all_of(points.begin(), points.end(), [](const Point& p) { return p.weight <= 0.0; }) ) {
+        for ( auto& point : points ) {
+            point.weight = 1.0;
+        }
+    }
+
+    part_output.verbose(CALL_INFO, 1, 0, "- Vertex Count:                     %10zu\n", points.size());
+    part_output.verbose(CALL_INFO, 1, 0, "- Part Count:                       %10" PRIu32 "\n", total_parts);
+    if ( !have_coords ) {
+        part_output.verbose(
+            CALL_INFO, 1, 0, "- No component coordinates were set, components will be partitioned in order\n");
+    }
+
+    std::vector<uint32_t> part(points.size(), 0);
+    recursiveBisect(points.begin(), points.end(), 0, total_parts, part);
+
+    std::vector<double> part_wgt(total_parts, 0.0);
+    for ( const auto& point : points ) {
+        part_wgt[part[point.index]] += point.weight;
+    }
+
+    uint32_t index = 0;
+    for ( auto* pcomp : pcomps ) {
+        pcomp->rank = convertPartNum(part[index++]);
+    }
+    graph->annotateRanks(pgraph.get());
+
+    reportPartition(graph, part_wgt);
+    part_output.verbose(CALL_INFO, 1, 0, "Partition scheme completed.\n");
+}
+
+SSTInertialBisectionPartition::SSTInertialBisectionPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity) :
+    SSTCoordinateBisectionPartition(
+        total_ranks, my_rank, verbosity, "InertialBisectionPartition ", "an inertial bisection")
+{}
+
+std::array<double, 3>
+SSTInertialBisectionPartition::getCutDirection(
+    std::vector<Point>::const_iterator begin, std::vector<Point>::const_iterator end)
+{
+    // Weighted center of mass
+    std::array<double, 3> center = { 0.0, 0.0, 0.0 };
+    double                total  = 0.0;
+    for ( auto it = begin; it != end; ++it ) {
+        for ( int d = 0; d < 3; d++ ) {
+            center[d] += it->weight * it->x[d];
+        }
+        total += it->weight;
+    }
+    if ( total <= 0.0 ) return SSTCoordinateBisectionPartition::getCutDirection(begin, end);
+    for ( int d = 0; d < 3; d++ ) {
+        center[d] /= total;
+    }
+
+    // Weighted covariance matrix
+    double cov[3][3] = {};
+    for ( auto it = begin; it != end; ++it ) {
+        for ( int i = 0; i < 3; i++ ) {
+            for ( int j = 0; j < 3; j++ ) {
+                cov[i][j] += it->weight * (it->x[i] - center[i]) * (it->x[j] - center[j]);
+            }
+        }
+    }
+
+    // The principal axis is the eigenvector with the largest
+    // eigenvalue, found with power iteration.  Start from the
+    // coordinate axis direction so degenerate cases fall back to it.
+    std::array<double, 3> dir = SSTCoordinateBisectionPartition::getCutDirection(begin, end);
+    for ( int d = 0; d < 3; d++ ) {
+        dir[d] += 0.1;
+    }
+    for ( int iter = 0; iter < power_iterations; iter++ ) {
+        std::array<double, 3> next = { 0.0, 0.0, 0.0 };
+        for ( int i = 0; i < 3; i++ ) {
+            for ( int j = 0; j < 3; j++ ) {
+                next[i] += cov[i][j] * dir[j];
+            }
+        }
+        const double norm = std::sqrt(next[0] * next[0] + next[1] * next[1] + next[2] * next[2]);
+        if ( norm == 0.0 ) return SSTCoordinateBisectionPartition::getCutDirection(begin, end);
+        for ( int d = 0; d < 3; d++ ) {
+            dir[d] = next[d] / norm;
+        }
+    }
+    return dir;
+}
+
+} // namespace SST::IMPL::Partition
@@ -0,0 +1,143 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_RCBPART_H
+#define SST_CORE_IMPL_PARTITONERS_RCBPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/model/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/sstpart.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SST::IMPL::Partition {
+
+/**
+   Recursive coordinate bisection partitioner.  Components are placed
+   using the coordinates set with setCoordinates() in the Python
+   model.  The set of components is recursively split at the weighted
+   median along the axis with the largest extent until there is one
+   part per rank/thread.  Components joined by no-cut links are placed
+   at the average of their coordinates and kept together.
+
+   The partition takes O(n log n log p) time and needs no information
+   about the links, so it is suitable for very large models with a
+   geometric layout such as meshes and tori.  If no coordinates are
+   set, all components are at the origin and the result is equivalent
+   to a linear partition.
+*/
+class SSTCoordinateBisectionPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTCoordinateBisectionPartition,
+        "sst",
+        "rcb",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Recursive coordinate bisection partitioner which splits components by their coordinates (set with "
+        "setCoordinates()) while balancing component weights across ranks and threads.")
+
+protected:
+    /** A component (or no-cut group of components) to partition */
+    struct Point
+    {
+        std::array<double, 3> x;
+        double                weight;
+        double                key;
+        uint32_t              index;
+    };
+
+    /** Number of ranks/threads in the simulation */
+    RankInfo    world_size;
+    /** Total number of parts to create */
+    uint32_t    total_parts;
+    /** Output object to print partitioning information */
+    Output      part_output;
+    /** Description of the partitioning scheme for the output */
+    std::string scheme;
+
+    SSTCoordinateBisectionPartition(
+        RankInfo total_ranks, RankInfo my_rank, int verbosity, const std::string& prefix, const std::string& scheme);
+
+    RankInfo convertPartNum(uint32_t part_num) const
+    {
+        return RankInfo(part_num / world_size.thread, part_num % world_size.thread);
+    }
+
+    /**
+       Returns the direction to cut the points in [begin, end).  By
+       default this is the coordinate axis with the largest extent.
+    */
+    virtual std::array<double, 3> getCutDirection(
+        std::vector<Point>::const_iterator begin, std::vector<Point>::const_iterator end);
+
+    /**
+       Recursively splits the points in [begin, end) into nparts parts,
+       numbered starting at first_part.  The part for each point is
+       written to part[point.index].
+    */
+    void recursiveBisect(std::vector<Point>::iterator begin, std::vector<Point>::iterator end, uint32_t first_part,
+        uint32_t nparts, std::vector<uint32_t>& part);
+
+    /** Prints the cut and balance metrics for the partitioned graph */
+    void reportPartition(ConfigGraph* graph, const std::vector<double>& part_wgt);
+
+public:
+    SSTCoordinateBisectionPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity);
+    ~SSTCoordinateBisectionPartition() {}
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(ConfigGraph* graph) override;
+
+    bool requiresConfigGraph() override { return true; }
+    bool spawnOnAllRanks() override { return false; }
+};
+
+/**
+   Recursive inertial bisection partitioner.  This works the same way
+   as the coordinate bisection partitioner, but each cut is made
+   perpendicular to the principal axis of the components being split
+   rather than a coordinate axis, which gives better cuts for models
+   that are not aligned with the axes.
+*/
+class SSTInertialBisectionPartition : public SSTCoordinateBisectionPartition
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTInertialBisectionPartition,
+        "sst",
+        "inertial",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Recursive inertial bisection partitioner which splits components along the principal axis of their "
+        "coordinates (set with setCoordinates()) while balancing component weights across ranks and threads.")
+
+protected:
+    std::array<double, 3> getCutDirection(
+        std::vector<Point>::const_iterator begin, std::vector<Point>::const_iterator end) override;
+
+public:
+    SSTInertialBisectionPartition(RankInfo total_ranks, RankInfo my_rank, int verbosity);
+    ~SSTInertialBisectionPartition() {}
+};
+
+} // namespace SST::IMPL::Partition
+
+#endif // SST_CORE_IMPL_PARTITONERS_RCBPART_H
@@ -42,6 +42,8 @@ REENABLE_WARNING
 #include "sst/core/mempoolAccessor.h"
 #include "sst/core/memuse.h"
 #include "sst/core/model/configGraph.h"
+#include "sst/core/model/partitionWeights.h"
+#include "sst/core/model/restart/sstcptmodel.h"
 #include "sst/core/model/sstmodel.h"
 #include "sst/core/objectComms.h"
 #include "sst/core/rankInfo.h"
@@ -71,6 +73,7 @@ REENABLE_WARNING
 // Configuration Graph Generation Options
 #include "sst/core/configGraphOutput.h"
 #include "sst/core/eli/elementinfo.h"
+#include "sst/core/model/cfgoutput/binaryConfigOutput.h"
 #include "sst/core/model/cfgoutput/dotConfigOutput.h"
 #include "sst/core/model/cfgoutput/jsonConfigOutput.h"
 #include "sst/core/model/cfgoutput/pythonConfigOutput.h"
@@ -83,6 +86,7 @@ using namespace SST;
 
 static SST::Output             g_output;
 static SST::Util::PerfReporter perfReporter;
+static SST::PartitionWeights   measuredWeights;
 
 
 // Functions to force initialization stages of simulation to execute
@@ -305,6 +309,23 @@ doParallelCapableGraphOutput(ConfigGraph* graph, const RankInfo& myRank, const R
         JSONConfigGraphOutput out(file_name.c_str());
         out.generate(&cfg, graph);
     }
+
+    // User asked us to dump the config graph in binary format
+    if ( cfg.output_binary_graph() != "" ) {
+        std::string file_name(cfg.output_binary_graph());
+        if ( cfg.parallel_output() ) {
+            // Append rank number to base filename
+            addRankToFileName(file_name, myRank.rank);
+        }
+        // The extension is needed for the file to be recognized as a
+        // binary graph when it is loaded
+        auto index = file_name.find_last_of('.');
+        if ( index == std::string::npos || file_name.substr(index) != ".sstgraph" ) {
+            g_output.fatal(CALL_INFO, 1, "--output-binary-graph requires a filename with a .sstgraph extension\n");
+        }
+        BinaryConfigGraphOutput out(file_name.c_str());
+        out.generate(&cfg, graph);
+    }
 }
 
 static void
@@ -399,6 +420,18 @@ start_partitioning(const RankInfo& world_size, const RankInfo& myRank, Factory*
         // // but the same code path
         // if ( world_size.rank == 1 && world_size.thread == 1 ) cfg.partitioner_ = "sst.single";
 
+        // Load weights measured by a previous run, if requested
+        PartitionWeights weights;
+        if ( myRank.rank == 0 && !cfg.partition_weights().empty() ) {
+            if ( !weights.readFile(cfg.partition_weights()) ) {
+                g_output.fatal(CALL_INFO, 1, "ERROR: Unable to read partition weights from file: %s\n",
+                    cfg.partition_weights().c_str());
+            }
+            size_t count = weights.applyComponentWeights(graph);
+            g_output.verbose(CALL_INFO, 1, 0, "Set partition weights for %zu components from %s\n", count,
+                cfg.partition_weights().c_str());
+        }
+
         // Get the partitioner.  Built in partitioners are in the "sst" library.
         SSTPartitioner* partitioner = factory->CreatePartitioner(cfg.partitioner(), world_size, myRank, cfg.verbose());
         try {
@@ -409,6 +442,10 @@ start_partitioning(const RankInfo& world_size, const RankInfo& myRank, Factory*
                 PartitionGraph* pgraph;
                 if ( myRank.rank == 0 ) {
                     pgraph = graph->getCollapsedPartitionGraph();
+                    if ( !weights.empty() ) {
+                        size_t count = weights.applyLinkTraffic(graph, pgraph);
+                        g_output.verbose(CALL_INFO, 1, 0, "Set measured traffic for %zu links\n", count);
+                    }
                 }
                 else {
                     pgraph = new PartitionGraph();
@@ -428,6 +465,42 @@ start_partitioning(const RankInfo& world_size, const RankInfo& myRank, Factory*
 
         delete partitioner;
     }
+    else {
+        // Parallel load.  Each rank has its own part of the graph and
+        // the ranks were set by the model, so only partitioners that
+        // can work on a partial graph are run.
+        SSTPartitioner* partitioner = factory->CreatePartitioner(cfg.partitioner(), world_size, myRank, cfg.verbose());
+        if ( partitioner->supportsPartialPartitionInput() ) {
+            PartitionWeights weights;
+            if ( !cfg.partition_weights().empty() ) {
+                if ( !weights.readFile(cfg.partition_weights()) ) {
+                    g_output.fatal(CALL_INFO, 1, "ERROR: Unable to read partition weights from file: %s\n",
+                        cfg.partition_weights().c_str());
+                }
+                weights.applyComponentWeights(graph);
+            }
+
+            try {
+                if ( partitioner->requiresConfigGraph() ) {
+                    // The partitioner can move components between
+                    // ranks, so it builds its own partition graph.
+                    // Measured link traffic is not used.
+                    partitioner->performPartition(graph);
+                }
+                else {
+                    PartitionGraph* pgraph = graph->getCollapsedPartitionGraph();
+                    if ( !weights.empty() ) weights.applyLinkTraffic(graph, pgraph);
+                    partitioner->performPartition(pgraph);
+                    graph->annotateRanks(pgraph);
+                    delete pgraph;
+                }
+            }
+            catch ( const std::exception& e ) {
+                g_output.fatal(CALL_INFO, -1, "Error encountered during graph partitioning phase: %s\n", e.what());
+            }
+        }
+        delete partitioner;
+    }
 
     // Check the partitioning to make sure it is sane
     if ( myRank.rank == 0 || cfg.parallel_load() ) {
@@ -438,6 +511,34 @@ start_partitioning(const RankInfo& world_size, const RankInfo& myRank, Factory*
     return sst_get_cpu_time() - start_part;
 }
 
+// Collects the partition weights measured on each rank and writes
+// them to the file given by --output-partition-weights on rank 0
+static void
+write_partition_weights(const RankInfo& myRank, const RankInfo& UNUSED(world_size))
+{
+    Config& cfg = Simulation::config;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( world_size.rank > 1 ) {
+        if ( myRank.rank == 0 ) {
+            for ( uint32_t rank = 1; rank < world_size.rank; rank++ ) {
+                PartitionWeights rank_weights;
+                Comms::recv(rank, 0, rank_weights);
+                measuredWeights.merge(rank_weights);
+            }
+        }
+        else {
+            Comms::send(0, 0, measuredWeights);
+        }
+    }
+#endif
+
+    if ( myRank.rank == 0 && !measuredWeights.writeFile(cfg.output_partition_weights()) ) {
+        g_output.output("WARNING: Unable to write partition weights to file: %s\n",
+            cfg.output_partition_weights().c_str());
+    }
+}
+
 struct SimThreadInfo_t
 {
     RankInfo     myRank;
@@ -455,6 +556,98 @@ struct SimThreadInfo_t
     uint64_t    sync_data_size;
 };
 
+// Restore the partitions from a checkpoint once the Simulation objects
+// and statistics engines have been created
+static void
+do_restart(ConfigGraph* graph, const std::string& registry_filename, SST::Simulation* sim, const RankInfo& myRank,
+    Core::ThreadSafe::Barrier& barrier)
+{
+    // Finish parsing checkpoint for restart
+    sim->restart(graph, registry_filename);
+
+    barrier.wait();
+
+    if ( myRank.thread == 0 ) {
+        sim->exchangeLinkInfo();
+    }
+
+    barrier.wait();
+
+    // Need to detect the sync intervals
+    if ( myRank.thread == 0 ) {
+        sim->findRankSyncInterval();
+    }
+
+    barrier.wait();
+
+    // Need to update the min_part variable in SyncManager
+    sim->updateSyncMinPart();
+
+    sim->findThreadSyncInterval();
+
+    barrier.wait();
+
+    sim->checkIndependent();
+
+    sim->prepare_for_run();
+}
+
+// Graph created from the checkpoint the simulation is being rewound
+// to, shared by all the threads
+static ConfigGraph* rewind_graph = nullptr;
+
+// Restart the simulation in place from the checkpoint kept in memory
+// that the interactive console rewound to.  The partitions are deleted
+// and restored through the same path as a restart from checkpoint
+// files, with the files read from memory.  The statistic outputs are
+// kept, so statistics continue to be written to the same outputs.
+static SST::Simulation*
+rewind_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier& barrier, SST::Simulation* sim)
+{
+    Config&                          cfg        = Simulation::config;
+    Checkpointing::MemoryCheckpoint* checkpoint = CheckpointAction::rewind_checkpoint;
+
+    delete sim;
+    barrier.wait();
+
+    if ( tid == 0 ) {
+        // Clear the static data that is restored from the checkpoint
+        Simulation::shutdown();
+        delete Simulation::stats_config_;
+        Simulation::stats_config_ = nullptr;
+
+        Checkpointing::setSource(checkpoint);
+        SSTCPTModelDefinition model(checkpoint->registry, cfg.verbose(), &cfg, sst_get_cpu_time());
+        rewind_graph = model.createConfigGraph();
+        rewind_graph->restoreRestartData();
+    }
+    barrier.wait();
+
+    sim = Simulation::createSimulation(
+        info.myRank, info.world_size, true, rewind_graph->cpt_currentSimCycle, rewind_graph->cpt_currentPriority);
+    sim->setupSimActions();
+
+    // Enter the console again at the time rewound to
+    sim->interactive_start_ = "0";
+    barrier.wait();
+
+    do_statengine_initialization(Simulation::stats_config_, sim, info.myRank);
+    barrier.wait();
+
+    do_restart(rewind_graph, checkpoint->registry, sim, info.myRank, barrier);
+    barrier.wait();
+
+    if ( tid == 0 ) {
+        Checkpointing::setSource(nullptr);
+        CheckpointAction::rewind_checkpoint = nullptr;
+        delete rewind_graph;
+        rewind_graph = nullptr;
+    }
+    barrier.wait();
+
+    return sim;
+}
+
 static void
 start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier& barrier, SimTime_t currentSimCycle,
     int currentPriority)
@@ -524,36 +717,7 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
     barrier.wait();
 
     if ( restart ) {
-
-        // Finish parsing checkpoint for restart
-        sim->restart(info.graph);
-
-        barrier.wait();
-
-        if ( info.myRank.thread == 0 ) {
-            sim->exchangeLinkInfo();
-        }
-
-        barrier.wait();
-
-        // Need to detect the sync intervals
-        if ( info.myRank.thread == 0 ) {
-            sim->findRankSyncInterval();
-        }
-
-        barrier.wait();
-
-        // Need to update the min_part variable in SyncManager
-        sim->updateSyncMinPart();
-
-        sim->findThreadSyncInterval();
-
-        barrier.wait();
-
-        sim->checkIndependent();
-
-        sim->prepare_for_run();
-
+        do_restart(info.graph, cfg.configFile(), sim, info.myRank, barrier);
     } // if ( restart )
 
     if ( !restart ) {
@@ -588,6 +752,8 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
             // Store off the stats config for use with checkpoints
             Simulation::stats_config_ = info.graph->takeStatsConfig();
             delete info.graph;
+
+            Simulation::reportElementCosts();
         }
 
         force_rank_sequential_stop(cfg.rank_seq_startup(), info.myRank, info.world_size);
@@ -672,7 +838,10 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
             barrier.wait();
 
             sim->prepare_for_run();
-            if ( tid == 0 ) Simulation::basicPerf.endRegion("setup");
+            if ( tid == 0 ) {
+                Simulation::reportElementCosts();
+                Simulation::basicPerf.endRegion("setup");
+            }
         } // end !RUNMODE == INIT
         else {
             // Need to all all the regions that were skipped because
@@ -713,7 +882,19 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
         if ( tid == 0 ) Simulation::basicPerf.beginRegion("run");
         sim->run();
         barrier.wait();
-        if ( tid == 0 ) Simulation::basicPerf.endRegion("run");
+
+        // Rewinding from the interactive console ends the run so the
+        // simulation can be restarted from a checkpoint kept in memory
+        while ( CheckpointAction::rewind_checkpoint != nullptr ) {
+            sim = rewind_simulation(tid, info, barrier, sim);
+            sim->run();
+            barrier.wait();
+        }
+
+        if ( tid == 0 ) {
+            CheckpointAction::finishWrites();
+            Simulation::basicPerf.endRegion("run");
+        }
 
         /* Adjust clocks at simulation end to
          * reflect actual simulation end if that
@@ -760,6 +941,7 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
 
     // Print the profiling info if requested
     sim->printProfilingInfo(&perfReporter);
+    if ( !cfg.output_partition_weights().empty() ) sim->addPartitionWeights(measuredWeights);
 
     // Put in info about sync memory usage
     info.sync_data_size = sim->getSyncQueueDataSize();
@@ -938,6 +1120,11 @@ main(int argc, char* argv[])
     // Count of the number of components
     uint64_t comp_count = 0;
 
+    // Memory used by rank 0's ConfigGraph after model generation
+    // (before partitioning) and after graph distribution
+    ConfigGraphMemoryUsage graph_mem_built;
+    ConfigGraphMemoryUsage graph_mem_local;
+
     Simulation::basicPerf.beginRegion("model-execution");
     Factory::createFactory(cfg.getLibPath());
     start_graph_creation(graph, world_size, myRank);
@@ -1008,6 +1195,10 @@ main(int argc, char* argv[])
             SST_MPI_Allreduce(&my_count, &comp_count, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
         }
         Simulation::basicPerf.addMetric("component count", comp_count);
+
+        if ( myRank.rank == 0 && (cfg.verbose() || cfg.print_timing()) ) {
+            graph_mem_built = graph->getMemoryUsage();
+        }
     }
 
 
@@ -1404,6 +1595,14 @@ main(int argc, char* argv[])
     Simulation::basicPerf.endRegion("graph-distribution");
     Simulation::basicPerf.endRegion("graph-processing");
 
+    if ( myRank.rank == 0 && !restart && (cfg.verbose() || cfg.print_timing()) ) {
+        graph_mem_local = graph->getMemoryUsage();
+    }
+
+    // The graph is complete, so components can look up their params
+    // without contending on the key table lock
+    Params::freezeKeyTable();
+
     /******** Register signal handlers, if not disabled ********/
     if ( cfg.enable_sig_handling() ) {
         g_output.verbose(CALL_INFO, 3, 0, "Signal handlers will be registered for USR1, USR2, INT, ALRM, and TERM\n");
@@ -1455,6 +1654,8 @@ main(int argc, char* argv[])
 
     // Initialize Simulation object data members and barriers
     Simulation::factory    = Factory::getFactory();
+    Simulation::factory->setParallelConstruction(cfg.parallel_construction());
+    Simulation::setElementCostTracking(cfg.verbose() || cfg.print_timing());
     Simulation::sim_output = g_output;
     Simulation::resizeBarriers(world_size.thread);
     CheckpointAction::barrier.resize(world_size.thread);
@@ -1604,10 +1805,130 @@ main(int argc, char* argv[])
             resources->addData("global_undeleted_activities", global_active_activities);
             resources->addData("global_current_timevortex_depth", global_current_tv_depth);
             resources->addData("global_max_timevortex_depth", global_max_tv_depth);
+
+            if ( graph_mem_built.num_components > 0 ) {
+                SST::Util::DataRecord* graph_mem = perfReporter.createDataRecord("graph_memory");
+                std::map<std::string, std::pair<std::string, std::string>> graph_key_map = {
+                    { "graph_memory", { "ConfigGraph Memory Usage (rank 0)", "" } },
+                    { "built_components", { "Components before partitioning", "" } },
+                    { "built_links", { "Links before partitioning", "" } },
+                    { "built_bytes_per_component", { "Bytes per component before partitioning", "B" } },
+                    { "built_bytes_per_link", { "Bytes per link before partitioning", "B" } },
+                    { "built_interned_bytes", { "Interned strings before partitioning", "" } },
+                    { "local_components", { "Components after distribution", "" } },
+                    { "local_links", { "Links after distribution", "" } },
+                    { "local_bytes_per_component", { "Bytes per component after distribution", "B" } },
+                    { "local_bytes_per_link", { "Bytes per link after distribution", "B" } },
+                    { "local_interned_bytes", { "Interned strings after distribution", "" } }
+                };
+                graph_mem->setKeys(graph_key_map);
+
+                auto per_item = [](uint64_t bytes, uint64_t count) {
+                    return count == 0 ? 0.0 : static_cast<double>(bytes) / count;
+                };
+                graph_mem->addData("built_components", graph_mem_built.num_components);
+                graph_mem->addData("built_links", graph_mem_built.num_links);
+                graph_mem->addData("built_bytes_per_component",
+                    per_item(graph_mem_built.component_bytes, graph_mem_built.num_components));
+                graph_mem->addData(
+                    "built_bytes_per_link", per_item(graph_mem_built.link_bytes, graph_mem_built.num_links));
+                graph_mem->addData("built_interned_bytes",
+                    UnitAlgebra(std::to_string(graph_mem_built.interned_string_bytes) + "B"));
+                graph_mem->addData("local_components", graph_mem_local.num_components);
+                graph_mem->addData("local_links", graph_mem_local.num_links);
+                graph_mem->addData("local_bytes_per_component",
+                    per_item(graph_mem_local.component_bytes, graph_mem_local.num_components));
+                graph_mem->addData(
+                    "local_bytes_per_link", per_item(graph_mem_local.link_bytes, graph_mem_local.num_links));
+                graph_mem->addData("local_interned_bytes",
+                    UnitAlgebra(std::to_string(graph_mem_local.interned_string_bytes) + "B"));
+            }
+
+            const auto& ckpt_times = CheckpointAction::times;
+            if ( ckpt_times.count > 0 ) {
+                SST::Util::DataRecord* ckpt = perfReporter.createDataRecord("checkpoint");
+                std::map<std::string, std::pair<std::string, std::string>> ckpt_key_map = {
+                    { "checkpoint", { "Checkpoint Timing (rank 0)", "" } },
+                    { "checkpoints", { "Checkpoints", "" } },
+                    { "stall_time", { "Total simulation stall time", "s" } },
+                    { "max_stall_time", { "Max stall time", "s" } },
+                    { "write_time", { "Total time to write checkpoints", "s" } },
+                    { "max_write_time", { "Max time to write checkpoint", "s" } }
+                };
+                ckpt->setKeys(ckpt_key_map);
+                ckpt->addData("checkpoints", ckpt_times.count);
+                ckpt->addData("stall_time", ckpt_times.stall);
+                ckpt->addData("max_stall_time", ckpt_times.max_stall);
+                ckpt->addData("write_time", ckpt_times.write);
+                ckpt->addData("max_write_time", ckpt_times.max_write);
+            }
+
+            // Tree records have a single root, so the sections and
+            // component types are reported as separate records
+            const auto& ckpt_profile = CheckpointAction::profile;
+            auto        add_profile  = [&](const std::string& name, const std::string& title,
+                                     const std::map<std::string, Checkpointing::CheckpointProfile::Entry>& entries) {
+                SST::Util::DataRecord* record =
+                    perfReporter.createDataRecord(name, SST::Util::DataRecord::TextFormat::tree);
+                std::map<std::string, std::pair<std::string, std::string>> profile_key_map = { { name, { title, "" } },
+                    { "total", { "Total", "" } }, { "count", { "Count", "" } }, { "bytes", { "Size", "B" } },
+                    { "time", { "Time", "s" } } };
+                record->setKeys(profile_key_map);
+
+                Checkpointing::CheckpointProfile::Entry total;
+                for ( auto& [entry_name, entry] : entries ) {
+                    total.bytes += entry.bytes;
+                    total.time += entry.time;
+                }
+                record->addChild("total");
+                record->setKeys(profile_key_map);
+                record->addData("bytes", total.bytes);
+                record->addData("time", total.time);
+                for ( auto& [entry_name, entry] : entries ) {
+                    record->addChild(entry_name);
+                    record->setKeys(profile_key_map);
+                    record->addData("count", entry.count);
+                    record->addData("bytes", entry.bytes);
+                    record->addData("time", entry.time);
+                    record->endChild();
+                }
+                record->endChild();
+            };
+            if ( !ckpt_profile.sections.empty() ) {
+                add_profile("checkpoint_sections", "Checkpoint Size and Time by Section (rank 0)", ckpt_profile.sections);
+                add_profile(
+                    "checkpoint_types", "Checkpoint Size and Time by Component Type (rank 0)", ckpt_profile.types);
+
+                const auto&            tracking = ckpt_profile.tracking;
+                SST::Util::DataRecord* record   = perfReporter.createDataRecord(
+                    "checkpoint_pointer_tracking", SST::Util::DataRecord::TextFormat::tree);
+                std::map<std::string, std::pair<std::string, std::string>> tracking_key_map = {
+                    { "checkpoint_pointer_tracking", { "Checkpoint Pointer Tracking (rank 0)", "" } },
+                    { "total", { "Total", "" } }, { "tables", { "Tables", "" } }, { "pointers", { "Pointers", "" } },
+                    { "max_pointers", { "Largest Table", "" } }, { "lookups", { "Lookups", "" } },
+                    { "hit_rate", { "Hit Rate", "" } }, { "probes_per_lookup", { "Probes per Lookup", "" } },
+                    { "shared_ptr_owners", { "Shared Pointer Owners", "" } } };
+                record->setKeys(tracking_key_map);
+                record->addChild("total");
+                record->setKeys(tracking_key_map);
+                record->addData("tables", tracking.tables);
+                record->addData("pointers", tracking.pointers);
+                record->addData("max_pointers", tracking.max_pointers);
+                record->addData("lookups", tracking.lookups);
+                record->addData("hit_rate", tracking.lookups ? double(tracking.hits) / tracking.lookups : 0.0);
+                record->addData(
+                    "probes_per_lookup", tracking.lookups ? double(tracking.probes) / tracking.lookups : 0.0);
+                record->addData("shared_ptr_owners", tracking.shared_ptr_owners);
+                record->endChild();
+            }
         }
     }
 
 
+    if ( !cfg.output_partition_weights().empty() ) {
+        write_partition_weights(myRank, world_size);
+    }
+
 #ifdef USE_MEMPOOL
     if ( cfg.event_dump_file() != "" ) {
         bool   print_header = false;
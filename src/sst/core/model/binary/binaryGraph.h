@@ -0,0 +1,107 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_MODEL_BINARY_BINARYGRAPH_H
+#define SST_CORE_MODEL_BINARY_BINARYGRAPH_H
+
+#include "sst/core/model/configStatistic.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/sst_types.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+   Layout of the binary ConfigGraph files written by
+   --output-binary-graph and read by the model.binary model.
+
+   The file starts with a Header, which is followed by the globals
+   record (program options, parameter keys, shared params, link
+   latencies and the statistics configuration), one serialized record
+   per component and one per link.  The file ends with the component
+   and link indices, which give the location of each record along with
+   the information needed to decide which records a rank needs.  This
+   lets each rank of a parallel load map the file and deserialize only
+   its own part of the graph.
+
+   All records are written with the SST serializer, so files can only
+   be read by the same version of SST on the same architecture.
+ */
+namespace SST::Core::BinaryGraph {
+
+constexpr char     magic[8] = { 'S', 'S', 'T', 'G', 'R', 'A', 'P', 'H' };
+constexpr uint32_t version  = 1;
+
+struct Header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t num_ranks;   /*!< Number of ranks the graph was partitioned for */
+    uint32_t num_threads; /*!< Number of threads per rank the graph was partitioned for */
+    uint32_t reserved;
+    uint64_t num_components;
+    uint64_t num_links;
+    uint64_t globals_offset;
+    uint64_t globals_size;
+    uint64_t component_index_offset; /*!< Offset of num_components ComponentEntry */
+    uint64_t link_index_offset;      /*!< Offset of num_links LinkEntry */
+};
+
+/** Graph wide data, which is needed by every rank */
+struct Globals
+{
+    std::string                                               sst_version;
+    std::map<std::string, std::string>                        program_options;
+    /** Names of the parameter keys, indexed by the key ids used in the Params objects */
+    std::vector<std::string>                                  param_keys;
+    std::map<std::string, std::map<std::string, std::string>> shared_params;
+    /** Link latencies, which the link records use in place of the latency values */
+    std::vector<std::string>                                  latencies;
+    StatsConfig*                                              stats_config = nullptr;
+
+    void serialize_order(SST::Core::Serialization::serializer& ser)
+    {
+        SST_SER(sst_version);
+        SST_SER(program_options);
+        SST_SER(param_keys);
+        SST_SER(shared_params);
+        SST_SER(latencies);
+        SST_SER(stats_config);
+    }
+};
+
+/** Index entry for a component record.  Entries are sorted by id. */
+struct ComponentEntry
+{
+    uint64_t      offset;
+    uint64_t      size;
+    ComponentId_t id;
+    uint32_t      rank;
+    uint32_t      thread;
+};
+
+/** Index entry for a link record */
+struct LinkEntry
+{
+    uint64_t      offset;
+    uint64_t      size;
+    /**
+       Top level components on each end of the link.  For nonlocal
+       links, component[1] is UNSET_COMPONENT_ID.
+    */
+    ComponentId_t component[2];
+};
+
+} // namespace SST::Core::BinaryGraph
+
+#endif // SST_CORE_MODEL_BINARY_BINARYGRAPH_H
@@ -0,0 +1,227 @@
+// -*- c++ -*-
+
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/model/binary/sstbinarymodel.h"
+
+#include "sst/core/model/configComponent.h"
+#include "sst/core/model/configLink.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/sst_mpi.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace SST::Core {
+
+SSTBinaryModelDefinition::SSTBinaryModelDefinition(
+    const std::string& script_file, int verbosity, Config* config, double UNUSED(start_time)) :
+    SSTModelDescription(config),
+    filename_(script_file),
+    config_(config)
+{
+    output_ = new Output("SSTBinaryModel: ", verbosity, 0, SST::Output::STDOUT);
+    output_->verbose(CALL_INFO, 2, 0, "SST loading a binary graph from file: %s\n", script_file.c_str());
+}
+
+SSTBinaryModelDefinition::~SSTBinaryModelDefinition()
+{
+    if ( data_ ) munmap(data_, size_);
+    delete output_;
+}
+
+template <typename T>
+const T*
+SSTBinaryModelDefinition::getRecord(uint64_t offset, uint64_t count)
+{
+    if ( offset > size_ || count > (size_ - offset) / sizeof(T) ) {
+        output_->fatal(CALL_INFO, 1, "Binary graph file %s is truncated or corrupt\n", filename_.c_str());
+    }
+    return reinterpret_cast<const T*>(data_ + offset);
+}
+
+template <typename T>
+void
+SSTBinaryModelDefinition::readRecord(uint64_t offset, uint64_t size, T& obj)
+{
+    // The unpacker does not write to the buffer, so it is safe to
+    // unpack straight from the read-only mapping
+    char* buffer = const_cast<char*>(getRecord<char>(offset, size));
+
+    SST::Core::Serialization::serializer ser;
+    ser.start_unpacking(buffer, size);
+    SST_SER(obj);
+}
+
+ConfigGraph*
+SSTBinaryModelDefinition::createConfigGraph()
+{
+    int fd = open(filename_.c_str(), O_RDONLY);
+    if ( fd < 0 ) {
+        output_->fatal(
+            CALL_INFO, 1, "Unable to open binary graph file [%s]: %s\n", filename_.c_str(), strerror(errno));
+    }
+    struct stat st;
+    if ( fstat(fd, &st) != 0 ) {
+        output_->fatal(
+            CALL_INFO, 1, "Unable to stat binary graph file [%s]: %s\n", filename_.c_str(), strerror(errno));
+    }
+    size_ = st.st_size;
+    if ( size_ < sizeof(BinaryGraph::Header) ) {
+        output_->fatal(CALL_INFO, 1, "File %s is not a binary graph file\n", filename_.c_str());
+    }
+
+    // Only the parts of the file this rank needs will be paged in
+    void* addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if ( addr == MAP_FAILED ) {
+        output_->fatal(
+            CALL_INFO, 1, "Unable to map binary graph file [%s]: %s\n", filename_.c_str(), strerror(errno));
+    }
+    data_ = static_cast<char*>(addr);
+
+    const BinaryGraph::Header* header = getRecord<BinaryGraph::Header>(0);
+    if ( memcmp(header->magic, BinaryGraph::magic, sizeof(BinaryGraph::magic)) != 0 ) {
+        output_->fatal(CALL_INFO, 1, "File %s is not a binary graph file\n", filename_.c_str());
+    }
+    if ( header->version != BinaryGraph::version ) {
+        output_->fatal(CALL_INFO, 1,
+            "Binary graph file %s has version %" PRIu32 ", but only version %" PRIu32 " is supported\n",
+            filename_.c_str(), header->version, BinaryGraph::version);
+    }
+
+    ////// Graph wide data //////
+    BinaryGraph::Globals globals;
+    readRecord(header->globals_offset, header->globals_size, globals);
+    if ( globals.sst_version != PACKAGE_STRING ) {
+        output_->fatal(CALL_INFO, 1,
+            "Version mismatch in binary graph file.  SSTCore version is %s. File version is %s\n", PACKAGE_STRING,
+            globals.sst_version.c_str());
+    }
+
+    // The Params objects are stored with their key ids, so the key ids
+    // need to be the same as when the file was written
+    if ( !restoreParamKeys(globals.param_keys) ) {
+        output_->fatal(CALL_INFO, 1,
+            "Parameter keys in use do not match the ones in binary graph file %s.  Binary graphs can not be combined "
+            "with other models.\n",
+            filename_.c_str());
+    }
+
+    for ( auto& set : globals.shared_params ) {
+        for ( auto& kvp : set.second ) {
+            insertGlobalParameter(set.first, kvp.first, kvp.second);
+        }
+    }
+
+    for ( auto& option : globals.program_options ) {
+        setOptionFromModel(option.first, option.second);
+    }
+
+    ConfigGraph* graph = new ConfigGraph();
+    graph->setStatsConfig(globals.stats_config);
+
+    ////// Components and links //////
+    const RankInfo world(config_->num_ranks(), config_->num_threads());
+    const uint32_t my_rank     = SST_MPI_GetRank();
+    const bool     parallel    = config_->parallel_load();
+    const bool     same_layout = header->num_ranks == world.rank && header->num_threads == world.thread;
+
+    if ( parallel && !same_layout ) {
+        output_->fatal(CALL_INFO, 1,
+            "Binary graph file %s was partitioned for %" PRIu32 " ranks and %" PRIu32
+            " threads and can only be loaded in parallel with the same number of ranks and threads\n",
+            filename_.c_str(), header->num_ranks, header->num_threads);
+    }
+
+    const BinaryGraph::ComponentEntry* comps =
+        getRecord<BinaryGraph::ComponentEntry>(header->component_index_offset, header->num_components);
+    const BinaryGraph::LinkEntry* links =
+        getRecord<BinaryGraph::LinkEntry>(header->link_index_offset, header->num_links);
+
+    auto find_entry = [&](ComponentId_t id) -> const BinaryGraph::ComponentEntry& {
+        const BinaryGraph::ComponentEntry* end = comps + header->num_components;
+        const BinaryGraph::ComponentEntry* it  = std::lower_bound(comps, end, id,
+            [](const BinaryGraph::ComponentEntry& entry, ComponentId_t value) { return entry.id < value; });
+        if ( it == end || it->id != id ) {
+            output_->fatal(CALL_INFO, 1, "Binary graph file %s references unknown component %" PRIu64 "\n",
+                filename_.c_str(), id);
+        }
+        return *it;
+    };
+    auto is_local = [&](ComponentId_t id) { return !parallel || find_entry(id).rank == my_rank; };
+
+    uint64_t comp_count = 0;
+    for ( uint64_t i = 0; i < header->num_components; ++i ) {
+        if ( parallel && comps[i].rank != my_rank ) continue;
+        ConfigComponent* comp = nullptr;
+        readRecord(comps[i].offset, comps[i].size, comp);
+        graph->insertComponent(comp);
+        comp_count++;
+    }
+
+    // Latencies are stored as indices into the file's latency table
+    std::vector<uint32_t> latencies;
+    for ( auto& latency : globals.latencies ) {
+        latencies.push_back(ConfigLink::getLatencyIndex(latency));
+    }
+
+    uint64_t link_count = 0;
+    for ( uint64_t i = 0; i < header->num_links; ++i ) {
+        const BinaryGraph::LinkEntry& entry    = links[i];
+        const bool                    nonlocal = entry.component[1] == UNSET_COMPONENT_ID;
+        const bool                    local0   = is_local(entry.component[0]);
+        const bool                    local1   = !nonlocal && is_local(entry.component[1]);
+        if ( !local0 && !local1 ) continue;
+
+        ConfigLink* link = nullptr;
+        readRecord(entry.offset, entry.size, link);
+        for ( int j = 0; j < 2; j++ ) {
+            if ( nonlocal && j == 1 ) continue;
+            link->latency_[j] = latencies.at(link->latency_[j]);
+        }
+
+        // The partition flags are recomputed once the ranks are checked
+        link->cross_rank_   = false;
+        link->cross_thread_ = false;
+
+        if ( !nonlocal && local0 != local1 ) {
+            const int                          which  = local0 ? 0 : 1;
+            const BinaryGraph::ComponentEntry& remote = find_entry(entry.component[1 - which]);
+            link->setAsNonLocal(which, RankInfo(remote.rank, remote.thread));
+        }
+        graph->insertLink(link);
+        link_count++;
+    }
+
+    output_->verbose(CALL_INFO, 1, 0,
+        "Loaded %" PRIu64 " of %" PRIu64 " components and %" PRIu64 " of %" PRIu64 " links from %s\n", comp_count,
+        header->num_components, link_count, header->num_links, filename_.c_str());
+
+    // The stored partition can be reused as is if the graph is loaded
+    // with the same number of ranks and threads it was partitioned for
+    if ( !parallel && same_layout ) setOptionFromModel("partitioner", "sst.self");
+
+    return graph;
+}
+
+} // namespace SST::Core
@@ -0,0 +1,74 @@
+// -*- c++ -*-
+
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_MODEL_BINARY_SSTBINARYMODEL_H
+#define SST_CORE_MODEL_BINARY_SSTBINARYMODEL_H
+
+#include "sst/core/config.h"
+#include "sst/core/model/binary/binaryGraph.h"
+#include "sst/core/model/configGraph.h"
+#include "sst/core/model/sstmodel.h"
+#include "sst/core/output.h"
+#include "sst/core/rankInfo.h"
+#include "sst/core/sst_types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace SST::Core {
+
+/**
+   Loads a ConfigGraph that was written with --output-binary-graph.
+   The file is memory mapped and, when loading in parallel, each rank
+   only deserializes the components it owns and the links connected
+   to them.
+ */
+class SSTBinaryModelDefinition : public SSTModelDescription
+{
+public:
+    SST_ELI_REGISTER_MODEL_DESCRIPTION(
+          SST::Core::SSTBinaryModelDefinition,
+          "sst",
+          "model.binary",
+          SST_ELI_ELEMENT_VERSION(1,0,0),
+          "Binary ConfigGraph model written by --output-binary-graph",
+          true)
+
+    SST_ELI_DOCUMENT_MODEL_SUPPORTED_EXTENSIONS(".sstgraph")
+
+    SSTBinaryModelDefinition(const std::string& script_file, int verbosity, Config* config, double start_time);
+    ~SSTBinaryModelDefinition();
+
+    ConfigGraph* createConfigGraph() override;
+
+protected:
+    std::string filename_;
+    Output*     output_ = nullptr;
+    Config*     config_ = nullptr;
+
+    char*  data_ = nullptr;
+    size_t size_ = 0;
+
+    /** Returns a pointer to the count objects of type T at offset, checking that they are inside the file */
+    template <typename T>
+    const T* getRecord(uint64_t offset, uint64_t count = 1);
+
+    /** Deserializes the record at offset into obj */
+    template <typename T>
+    void readRecord(uint64_t offset, uint64_t size, T& obj);
+};
+
+} // namespace SST::Core
+
+#endif // SST_CORE_MODEL_BINARY_SSTBINARYMODEL_H
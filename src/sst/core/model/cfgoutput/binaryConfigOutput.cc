@@ -0,0 +1,167 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#include "sst_config.h"
+
+#include "sst/core/model/cfgoutput/binaryConfigOutput.h"
+
+#include "sst/core/config.h"
+#include "sst/core/model/binary/binaryGraph.h"
+#include "sst/core/model/configComponent.h"
+#include "sst/core/model/configLink.h"
+#include "sst/core/serialization/serializer.h"
+
+#include <cstring>
+#include <map>
+#include <string>
+
+using namespace SST::Core;
+
+BinaryConfigGraphOutput::BinaryConfigGraphOutput(const char* path) :
+    ConfigGraphOutput(path)
+{}
+
+void
+BinaryConfigGraphOutput::write(const void* data, size_t size)
+{
+    if ( size != 0 && fwrite(data, 1, size, outputFile) != size ) {
+        throw ConfigGraphOutputException("Error writing binary graph file");
+    }
+    offset_ += size;
+}
+
+void
+BinaryConfigGraphOutput::align()
+{
+    static const char padding[8] = {};
+    if ( offset_ % 8 != 0 ) write(padding, 8 - (offset_ % 8));
+}
+
+template <typename T>
+uint64_t
+BinaryConfigGraphOutput::writeRecord(T& data)
+{
+    SST::Core::Serialization::serializer ser;
+
+    ser.start_sizing();
+    SST_SER(data);
+    size_t size = ser.size();
+
+    buffer_.resize(size);
+    ser.start_packing(buffer_.data(), size);
+    SST_SER(data);
+
+    write(buffer_.data(), size);
+    return size;
+}
+
+void
+BinaryConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
+{
+    if ( nullptr == outputFile ) {
+        throw ConfigGraphOutputException("Output file is not open for writing");
+    }
+
+    BinaryGraph::Header header = {};
+    std::memcpy(header.magic, BinaryGraph::magic, sizeof(header.magic));
+    header.version     = BinaryGraph::version;
+    header.num_ranks   = cfg->num_ranks();
+    header.num_threads = cfg->num_threads();
+    write(&header, sizeof(header));
+
+    // The latencies in the graph have already been converted to
+    // SimTime_t, so the link records refer to a table of latency
+    // strings instead, which are converted using the timebase when
+    // the graph is loaded
+    ConfigLinkMap_t&              links = graph->getLinkMap();
+    std::map<SimTime_t, uint64_t> latency_index;
+    BinaryGraph::Globals          globals;
+    for ( ConfigLink* link : links ) {
+        for ( int j = 0; j < 2; j++ ) {
+            if ( link->nonlocal_ && j == 1 ) continue;
+            auto ret = latency_index.emplace(link->latency_[j], globals.latencies.size());
+            if ( ret.second ) globals.latencies.push_back(link->latency_str(j));
+        }
+    }
+
+    // The partitioner is left out because the loader either reuses the
+    // stored partition or the graph is loaded with a different number
+    // of ranks and threads
+    globals.sst_version                               = PACKAGE_STRING;
+    globals.program_options["verbose"]                = std::to_string(cfg->verbose());
+    globals.program_options["stop-at"]                = cfg->stop_at();
+    globals.program_options["timing-info"]            = std::to_string(cfg->print_timing());
+    globals.program_options["heartbeat-sim-period"]   = cfg->heartbeat_sim_period();
+    globals.program_options["heartbeat-wall-period"]  = std::to_string(cfg->heartbeat_wall_period());
+    globals.program_options["timebase"]               = cfg->timeBase();
+    globals.program_options["timeVortex"]             = cfg->timeVortex();
+    globals.program_options["interthread-links"]      = cfg->interthread_links() ? "true" : "false";
+    globals.program_options["output-prefix-core"]     = cfg->output_core_prefix();
+    globals.program_options["checkpoint-sim-period"]  = cfg->checkpoint_sim_period();
+    globals.program_options["checkpoint-wall-period"] = std::to_string(cfg->checkpoint_wall_period());
+    globals.param_keys                                = getParamKeyNames();
+    for ( auto& name : getSharedParamSetNames() ) {
+        globals.shared_params[name] = getSharedParamSet(name);
+    }
+    globals.stats_config = graph->getStatsConfig();
+
+    header.globals_offset = offset_;
+    header.globals_size   = writeRecord(globals);
+
+    // Component records, in order of ID
+    std::vector<BinaryGraph::ComponentEntry> comp_index;
+    comp_index.reserve(graph->getNumComponents());
+    for ( ConfigComponent* comp : graph->getComponentMap() ) {
+        BinaryGraph::ComponentEntry entry;
+        entry.offset = offset_;
+        entry.size   = writeRecord(comp);
+        entry.id     = comp->id;
+        entry.rank   = comp->rank.rank;
+        entry.thread = comp->rank.thread;
+        comp_index.push_back(entry);
+    }
+
+    // Link records
+    std::vector<BinaryGraph::LinkEntry> link_index;
+    link_index.reserve(links.size());
+    for ( ConfigLink* link : links ) {
+        ConfigLink  tmp(*link);
+        ConfigLink* record = &tmp;
+        for ( int j = 0; j < 2; j++ ) {
+            if ( link->nonlocal_ && j == 1 ) continue;
+            tmp.latency_[j] = latency_index[link->latency_[j]];
+        }
+
+        BinaryGraph::LinkEntry entry;
+        entry.offset       = offset_;
+        entry.size         = writeRecord(record);
+        entry.component[0] = COMPONENT_ID_MASK(link->component_[0]);
+        entry.component[1] = link->nonlocal_ ? UNSET_COMPONENT_ID : COMPONENT_ID_MASK(link->component_[1]);
+        link_index.push_back(entry);
+    }
+
+    // Indices go at the end so that the records can be written in a
+    // single pass
+    align();
+    header.num_components         = comp_index.size();
+    header.component_index_offset = offset_;
+    write(comp_index.data(), comp_index.size() * sizeof(BinaryGraph::ComponentEntry));
+
+    header.num_links         = link_index.size();
+    header.link_index_offset = offset_;
+    write(link_index.data(), link_index.size() * sizeof(BinaryGraph::LinkEntry));
+
+    if ( fseek(outputFile, 0, SEEK_SET) != 0 || fwrite(&header, sizeof(header), 1, outputFile) != 1 ) {
+        throw ConfigGraphOutputException("Error writing binary graph file");
+    }
+    fflush(outputFile);
+}
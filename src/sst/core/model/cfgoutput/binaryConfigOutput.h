@@ -0,0 +1,50 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#ifndef SST_CORE_BINARY_CONFIG_OUTPUT_H
+#define SST_CORE_BINARY_CONFIG_OUTPUT_H
+
+#include "sst/core/configGraphOutput.h"
+#include "sst/core/model/configGraph.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SST::Core {
+
+/**
+   Writes the ConfigGraph in the binary format described in
+   sst/core/model/binary/binaryGraph.h, which can be loaded again
+   without rerunning the model that built the graph.
+ */
+class BinaryConfigGraphOutput : public ConfigGraphOutput
+{
+
+public:
+    explicit BinaryConfigGraphOutput(const char* path);
+    virtual void generate(const Config* cfg, ConfigGraph* graph) override;
+
+private:
+    std::vector<char> buffer_;
+    uint64_t          offset_ = 0;
+
+    void write(const void* data, size_t size);
+    void align();
+
+    /** Serializes data to the end of the file and returns its size */
+    template <typename T>
+    uint64_t writeRecord(T& data);
+};
+
+} // namespace SST::Core
+
+#endif // SST_CORE_BINARY_CONFIG_OUTPUT_H
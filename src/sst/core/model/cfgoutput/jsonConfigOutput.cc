@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <map>
@@ -74,7 +75,20 @@ JSONConfigGraphOutput::outputLinks(ConfigGraph* graph, std::ofstream& ofs)
                 linkRecord["right"]["latency"]   = linkItr->latency_str(1);
             }
 
+            JSONIndex::LinkEntry entry = {};
+            if ( write_index_ ) {
+                entry.offset       = ofs.tellp();
+                entry.component[0] = comp_index_.at(COMPONENT_ID_MASK(linkItr->component_[0]));
+                entry.component[1] = linkItr->nonlocal_ ? JSONIndex::no_component
+                                                        : comp_index_.at(COMPONENT_ID_MASK(linkItr->component_[1]));
+            }
+
             ofs << linkRecord.dump(2);
+            if ( write_index_ ) {
+                entry.size = static_cast<uint64_t>(ofs.tellp()) - entry.offset;
+                index_links_.push_back(entry);
+            }
+
             if ( count != const_cast<ConfigLinkMap_t&>(linkMap).size() ) {
                 ofs << ",\n";
             }
@@ -196,7 +210,20 @@ JSONConfigGraphOutput::outputComponents(const Config* cfg, ConfigGraph* graph, s
                 comp_record["port_modules"] = port_modules_array;
             }
 
+            JSONIndex::ComponentEntry entry = {};
+            if ( write_index_ ) {
+                entry.offset = ofs.tellp();
+                entry.rank   = cfg->output_partition() ? comp_itr->rank.rank : RankInfo::UNASSIGNED;
+                entry.thread = cfg->output_partition() ? comp_itr->rank.thread : RankInfo::UNASSIGNED;
+            }
+
             ofs << comp_record.dump(2);
+            if ( write_index_ ) {
+                entry.size                = static_cast<uint64_t>(ofs.tellp()) - entry.offset;
+                comp_index_[comp_itr->id] = index_comps_.size();
+                index_comps_.push_back(entry);
+            }
+
             if ( count == const_cast<ConfigComponentMap_t&>(comp_map).size() ) {
                 ofs << "\n";
             }
@@ -465,18 +492,52 @@ JSONConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
         throw ConfigGraphOutputException("Streaming output file is not open for writing");
     }
 
+    JSONIndex::Header header = {};
+    write_index_             = cfg->output_json_index();
+
     ofs << "{\n";
 
     // output each top-level section
     outputProgramOptions(cfg, ofs);
     outputSharedParams(ofs);
     outputStatisticsOptions(graph, ofs);
+    header.preamble_size = ofs.tellp();
     outputComponents(cfg, graph, ofs);
+    header.stat_groups_offset = ofs.tellp();
     outputStatisticsGroups(graph, ofs);
+    header.stat_groups_size = static_cast<uint64_t>(ofs.tellp()) - header.stat_groups_offset;
     outputLinks(graph, ofs);
 
     // close the output stream
     ofs << "}\n";
     ofs.flush();
+    header.json_size = ofs.tellp();
+    ofs.close();
+
+    if ( write_index_ ) outputIndex(header);
+}
+
+void
+JSONConfigGraphOutput::outputIndex(const JSONIndex::Header& header_in)
+{
+    JSONIndex::Header header = header_in;
+    std::memcpy(header.magic, JSONIndex::magic, sizeof(header.magic));
+    header.version        = JSONIndex::version;
+    header.num_components = index_comps_.size();
+    header.num_links      = index_links_.size();
+
+    SST::Util::Filesystem filesystem = Simulation::filesystem;
+    std::ofstream         ofs =
+        filesystem.ofstream(pathStr + JSONIndex::indexSuffix, std::ofstream::out | std::ofstream::binary);
+    if ( !ofs.is_open() ) {
+        throw ConfigGraphOutputException("Index file is not open for writing");
+    }
+
+    ofs.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    ofs.write(reinterpret_cast<const char*>(index_comps_.data()), index_comps_.size() * sizeof(index_comps_[0]));
+    ofs.write(reinterpret_cast<const char*>(index_links_.data()), index_links_.size() * sizeof(index_links_[0]));
+    if ( !ofs ) {
+        throw ConfigGraphOutputException("Error writing index file");
+    }
     ofs.close();
 }
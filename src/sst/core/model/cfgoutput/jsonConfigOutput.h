@@ -15,6 +15,7 @@
 
 #include "sst/core/configGraphOutput.h"
 #include "sst/core/model/configGraph.h"
+#include "sst/core/model/json/jsonIndex.h"
 #include "sst/core/util/filesystem.h"
 
 #include "nlohmann/json.hpp"
@@ -22,6 +23,8 @@
 #include <fstream>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace SST::Core {
 
@@ -38,6 +41,13 @@ private:
 
     std::string pathStr;
 
+    // Locations of the records, written to the sidecar index if
+    // --output-json-index is given
+    bool                                             write_index_ = false;
+    std::vector<JSONIndex::ComponentEntry>           index_comps_;
+    std::vector<JSONIndex::LinkEntry>                index_links_;
+    std::unordered_map<SST::ComponentId_t, uint64_t> comp_index_; // Component ID to position in index_comps_
+
     void                   outputProgramOptions(const Config* cfg, std::ofstream& ofs);
     void                   outputSharedParams(std::ofstream& ofs);
     void                   outputStatisticsOptions(ConfigGraph* graph, std::ofstream& ofs);
@@ -45,6 +55,7 @@ private:
     void                   outputComponents(const Config* cfg, ConfigGraph* graph, std::ofstream& ofs);
     nlohmann::ordered_json outputSubComponent(ConfigComponent* sub, std::ofstream& ofs);
     void                   outputLinks(ConfigGraph* graph, std::ofstream& ofs);
+    void                   outputIndex(const JSONIndex::Header& header);
 };
 
 } // namespace SST::Core
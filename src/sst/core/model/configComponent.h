@@ -15,6 +15,7 @@
 #define SST_CORE_MODEL_CONFIGCOMPONENT_H
 
 #include "sst/core/model/configStatistic.h"
+#include "sst/core/model/internedString.h"
 #include "sst/core/params.h"
 #include "sst/core/rankInfo.h"
 #include "sst/core/serialization/serializable.h"
@@ -88,7 +89,7 @@ public:
     ConfigGraph*          graph;         /*!< Graph that this component belongs to */
     std::string           name;          /*!< Name of this component, or slot name for subcomp */
     int                   slot_num;      /*!< Slot number.  Only valid for subcomponents */
-    std::string           type;          /*!< Type of this component */
+    InternedString        type;          /*!< Type of this component */
     float                 weight;        /*!< Partitioning weight for this component */
     RankInfo              rank;          /*!< Parallel Rank for this component */
     std::vector<LinkId_t> links;         /*!< List of links connected */
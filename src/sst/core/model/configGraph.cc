@@ -20,6 +20,8 @@
 #include "sst/core/model/configLink.h"
 #include "sst/core/model/configStatistic.h"
 #include "sst/core/namecheck.h"
+#include "sst/core/objectSerialization.h"
+#include "sst/core/paramsMap.h"
 #include "sst/core/simulation.h"
 #include "sst/core/sst_mpi.h"
 #include "sst/core/timeLord.h"
@@ -28,8 +30,13 @@
 #include <algorithm>
 #include <cstdio>
 #include <fstream>
+#include <map>
+#include <memory>
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -68,6 +75,104 @@ checkForValidLinkName(const std::string& name)
         bad_link_name_count++;
     }
 }
+
+// Approximate overhead of a red-black tree node, not counting the value
+constexpr size_t map_node_overhead = 4 * sizeof(void*);
+
+// Bytes allocated on the heap by a string.  Short strings are stored
+// in the object itself.
+size_t
+stringHeapSize(const std::string& str)
+{
+    if ( str.capacity() <= std::string().capacity() ) return 0;
+    return str.capacity() + 1;
+}
+
+size_t
+paramsMemoryUsage(const SST::ParamsMap& data)
+{
+    size_t bytes = data.capacity() * sizeof(SST::ParamsMap::value_type);
+    for ( auto& [key, value] : data ) {
+        bytes += stringHeapSize(value);
+    }
+    return bytes;
+}
+
+// Moves the ID of comp and its subcomponents to the component ID base.
+// Subcomponent IDs keep their upper bits.
+void
+renumberComponent(SST::ConfigComponent* comp, SST::ComponentId_t base)
+{
+    comp->id = comp->id - SST::COMPONENT_ID_MASK(comp->id) + base;
+    for ( auto* sub : comp->subComponents ) {
+        renumberComponent(sub, base);
+    }
+}
+
+#ifdef SST_CONFIG_HAVE_MPI
+// Tag used when moving components between ranks
+constexpr int redistribute_tag = 0;
+
+// Serializes a graph to send to another rank.  Pointer tracking makes
+// Params serialize their keys by name, since the key IDs differ
+// between ranks with parallel load.
+std::vector<char>
+packGraph(SST::ConfigGraph& graph)
+{
+    SST::Core::Serialization::serializer ser;
+    ser.enable_pointer_tracking();
+    ser.start_packing();
+    SST_SER(graph);
+
+    std::vector<char> buffer(ser.size());
+    ser.copy_packed(buffer.data());
+    return buffer;
+}
+
+void
+unpackGraph(std::vector<char>& buffer, SST::ConfigGraph& graph)
+{
+    SST::Core::Serialization::serializer ser;
+    ser.enable_pointer_tracking();
+    ser.start_unpacking(buffer.data(), buffer.size());
+    SST_SER(graph);
+}
+
+// Sends send[r] to rank r and receives the buffer sent to this rank by
+// rank r into recv[r].  Large buffers are sent in fragments, the same
+// as Comms::send().
+void
+exchangeBuffers(std::vector<std::vector<char>>& send, std::vector<std::vector<char>>& recv)
+{
+    const int world = send.size();
+
+    std::vector<int64_t> send_size(world), recv_size(world);
+    for ( int r = 0; r < world; r++ ) {
+        send_size[r] = send[r].size();
+    }
+    MPI_Alltoall(send_size.data(), 1, MPI_INT64_T, recv_size.data(), 1, MPI_INT64_T, MPI_COMM_WORLD);
+
+    constexpr int64_t        fragment_size = 1000000000;
+    std::vector<MPI_Request> requests;
+    recv.assign(world, std::vector<char>());
+    for ( int r = 0; r < world; r++ ) {
+        recv[r].resize(recv_size[r]);
+        for ( int64_t offset = 0; offset < recv_size[r]; offset += fragment_size ) {
+            requests.emplace_back();
+            MPI_Irecv(recv[r].data() + offset, std::min(fragment_size, recv_size[r] - offset), MPI_BYTE, r,
+                redistribute_tag, MPI_COMM_WORLD, &requests.back());
+        }
+    }
+    for ( int r = 0; r < world; r++ ) {
+        for ( int64_t offset = 0; offset < send_size[r]; offset += fragment_size ) {
+            requests.emplace_back();
+            MPI_Isend(send[r].data() + offset, std::min(fragment_size, send_size[r] - offset), MPI_BYTE, r,
+                redistribute_tag, MPI_COMM_WORLD, &requests.back());
+        }
+    }
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+}
+#endif
 } // anonymous namespace
 
 
@@ -145,6 +250,60 @@ ConfigGraph::getNumComponentsInMPIRank(uint32_t rank)
     return count;
 }
 
+size_t
+ConfigGraph::getComponentMemoryUsage(const ConfigComponent* comp)
+{
+    size_t bytes = sizeof(ConfigComponent) + stringHeapSize(comp->name);
+    bytes += comp->links.capacity() * sizeof(LinkId_t);
+    bytes += comp->coords.capacity() * sizeof(double);
+    bytes += comp->subComponents.capacity() * sizeof(ConfigComponent*);
+    bytes += paramsMemoryUsage(comp->params.my_data);
+    bytes += comp->params.data.capacity() * sizeof(void*);
+
+    for ( auto& [port, modules] : comp->port_modules ) {
+        bytes += map_node_overhead + sizeof(std::pair<const std::string, std::vector<ConfigPortModule>>) +
+                 stringHeapSize(port);
+        for ( auto& module : modules ) {
+            bytes += sizeof(ConfigPortModule) + stringHeapSize(module.type) + paramsMemoryUsage(module.params.my_data);
+        }
+    }
+    for ( auto& [stat_name, stat_id] : comp->enabledStatNames ) {
+        bytes += map_node_overhead + sizeof(std::pair<const std::string, StatisticId_t>) + stringHeapSize(stat_name);
+    }
+    for ( auto& [stat_id, stat] : comp->statistics_ ) {
+        bytes += map_node_overhead + sizeof(std::pair<const StatisticId_t, ConfigStatistic>) +
+                 paramsMemoryUsage(stat.params.my_data);
+    }
+
+    for ( auto* sub : comp->subComponents ) {
+        bytes += getComponentMemoryUsage(sub);
+    }
+    return bytes;
+}
+
+ConfigGraphMemoryUsage
+ConfigGraph::getMemoryUsage() const
+{
+    ConfigGraphMemoryUsage usage;
+    usage.num_components = comps_.data.size();
+    usage.num_links      = links_.data.size();
+
+    for ( auto* comp : comps_ ) {
+        usage.component_bytes += sizeof(ConfigComponent*) + getComponentMemoryUsage(comp);
+    }
+    // Each component name is also a key in comps_by_name_
+    for ( auto& [name, id] : comps_by_name_ ) {
+        usage.component_bytes +=
+            map_node_overhead + sizeof(std::pair<const std::string, ComponentId_t>) + stringHeapSize(name);
+    }
+
+    for ( auto* link : links_ ) {
+        usage.link_bytes += sizeof(ConfigLink*) + sizeof(ConfigLink) + stringHeapSize(link->name_);
+    }
+
+    usage.interned_string_bytes = InternedString::getTableMemoryUsage();
+    return usage;
+}
 
 void
 ConfigGraph::setComponentRanks(RankInfo rank)
@@ -331,6 +490,33 @@ ConfigGraph::addComponent(const std::string& name, const std::string& type)
     return cid;
 }
 
+void
+ConfigGraph::insertComponent(ConfigComponent* comp)
+{
+    comp->setConfigGraphPointer(this);
+    comps_.insert(comp);
+
+    auto ret = comps_by_name_.insert(std::make_pair(comp->name, comp->id));
+    if ( !ret.second ) {
+        output.fatal(
+            CALL_INFO, 1, "ERROR: trying to add Component with name that already exists: %s\n", comp->name.c_str());
+    }
+    if ( comp->id >= nextComponentId ) nextComponentId = comp->id + 1;
+}
+
+void
+ConfigGraph::insertLink(ConfigLink* link)
+{
+    links_.insert(link);
+}
+
+void
+ConfigGraph::setStatsConfig(StatsConfig* config)
+{
+    if ( stats_config_ ) delete stats_config_;
+    stats_config_ = config;
+}
+
 void
 ConfigGraph::addSharedParam(const std::string& shared_set, const std::string& key, const std::string& value)
 {
@@ -707,6 +893,183 @@ ConfigGraph::reduceGraphToSingleRank(uint32_t rank)
     splitGraph(ranks, std::set<uint32_t>());
 }
 
+void
+ConfigGraph::redistributeComponents(uint32_t UNUSED_WO_MPI(my_rank), uint32_t UNUSED_WO_MPI(num_ranks))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Split off the components going to each rank
+    std::set<uint32_t> dests;
+    for ( auto* comp : comps_ ) {
+        if ( comp->rank.rank != my_rank ) dests.insert(comp->rank.rank);
+    }
+
+    std::vector<std::vector<char>> buffers(num_ranks);
+    for ( uint32_t dest : dests ) {
+        std::set<uint32_t> keep;
+        for ( uint32_t r = 0; r < num_ranks; r++ ) {
+            if ( r != dest ) keep.insert(r);
+        }
+
+        std::unique_ptr<ConfigGraph> graph(splitGraph(keep, { dest }));
+        for ( auto* comp : graph->comps_ ) {
+            comps_by_name_.erase(comp->name);
+        }
+        buffers[dest] = packGraph(*graph);
+        for ( auto* link : graph->links_ ) {
+            delete link;
+        }
+    }
+
+    // Stat groups are kept on every rank, but should only list the
+    // components that are still here
+    for ( auto& [name, group] : stats_config_->groups ) {
+        auto& ids = group.components;
+        ids.erase(std::remove_if(ids.begin(), ids.end(), [this](ComponentId_t id) { return !containsComponent(id); }),
+            ids.end());
+    }
+
+    std::vector<std::vector<char>> received;
+    exchangeBuffers(buffers, received);
+    buffers.clear();
+
+    std::map<std::string, ConfigLink*> nonlocal;
+    for ( auto* link : links_ ) {
+        if ( link->nonlocal_ ) nonlocal[link->name_] = link;
+    }
+
+    for ( auto& buffer : received ) {
+        if ( buffer.empty() ) continue;
+        ConfigGraph graph;
+        unpackGraph(buffer, graph);
+        std::vector<char>().swap(buffer);
+        mergeGraph(graph, nonlocal);
+    }
+
+    // The other end of a nonlocal link may have moved to a different
+    // rank or thread.  Each end sends its rank and thread to a
+    // directory rank chosen by the link name, which replies with the
+    // rank and thread of the other end.
+    using RemoteEnd = std::pair<std::string, std::pair<uint32_t, uint32_t>>;
+
+    std::vector<std::vector<RemoteEnd>>   requests(num_ranks);
+    std::vector<std::vector<ConfigLink*>> requested(num_ranks);
+    std::hash<std::string>                hasher;
+    for ( auto& [name, link] : nonlocal ) {
+        const RankInfo& rank = comps_[COMPONENT_ID_MASK(link->component_[0])]->rank;
+        const uint32_t  dir  = hasher(name) % num_ranks;
+        requests[dir].emplace_back(name, std::make_pair(rank.rank, rank.thread));
+        requested[dir].push_back(link);
+    }
+
+    buffers.resize(num_ranks);
+    for ( uint32_t r = 0; r < num_ranks; r++ ) {
+        buffers[r] = Comms::serialize(requests[r]);
+    }
+    exchangeBuffers(buffers, received);
+
+    // Both ends of every nonlocal link report to the same directory
+    // rank.  Replies are in the same order as the requests, and an end
+    // whose other end didn't report keeps its current remote rank.
+    constexpr uint32_t no_reply = std::numeric_limits<uint32_t>::max();
+
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>>                 replies(num_ranks);
+    std::unordered_map<std::string, std::vector<std::pair<uint32_t, size_t>>> ends;
+    std::vector<std::vector<RemoteEnd>>                                      entries(num_ranks);
+    for ( uint32_t r = 0; r < num_ranks; r++ ) {
+        Comms::deserialize(received[r], entries[r]);
+        replies[r].assign(entries[r].size(), std::make_pair(no_reply, no_reply));
+        for ( size_t i = 0; i < entries[r].size(); i++ ) {
+            ends[entries[r][i].first].emplace_back(r, i);
+        }
+    }
+    for ( auto& [name, end] : ends ) {
+        if ( end.size() != 2 ) continue;
+        replies[end[0].first][end[0].second] = entries[end[1].first][end[1].second].second;
+        replies[end[1].first][end[1].second] = entries[end[0].first][end[0].second].second;
+    }
+
+    for ( uint32_t r = 0; r < num_ranks; r++ ) {
+        buffers[r] = Comms::serialize(replies[r]);
+    }
+    exchangeBuffers(buffers, received);
+
+    for ( uint32_t r = 0; r < num_ranks; r++ ) {
+        std::vector<std::pair<uint32_t, uint32_t>> reply;
+        Comms::deserialize(received[r], reply);
+        for ( size_t i = 0; i < reply.size(); i++ ) {
+            if ( reply[i].first == no_reply ) continue;
+            requested[r][i]->component_[1] = reply[i].first;
+            requested[r][i]->latency_[1]   = reply[i].second;
+        }
+    }
+#endif
+}
+
+void
+ConfigGraph::mergeGraph(ConfigGraph& graph, std::map<std::string, ConfigLink*>& nonlocal)
+{
+    // Components are inserted one at a time so that an ID given to an
+    // earlier component is seen as used
+    std::unordered_map<ComponentId_t, ComponentId_t> new_id;
+    for ( auto* comp : graph.comps_ ) {
+        ComponentId_t id = comp->id;
+        if ( containsComponent(id) ) id = nextComponentId;
+        new_id[comp->id] = id;
+        if ( id != comp->id ) renumberComponent(comp, id);
+        insertComponent(comp);
+    }
+    graph.comps_.clear();
+
+    auto remap = [&new_id](ComponentId_t id) { return id - COMPONENT_ID_MASK(id) + new_id.at(COMPONENT_ID_MASK(id)); };
+
+    for ( auto* link : graph.links_ ) {
+        link->component_[0] = remap(link->component_[0]);
+        if ( !link->nonlocal_ ) {
+            link->component_[1] = remap(link->component_[1]);
+        }
+        else {
+            auto it = nonlocal.find(link->name_);
+            if ( it != nonlocal.end() ) {
+                // The other end is already on this rank, so join the
+                // two halves back into a local link
+                ConfigLink* local    = it->second;
+                local->component_[1] = link->component_[0];
+                local->port_[1]      = link->port_[0];
+                local->latency_[1]   = link->latency_[0];
+                local->nonlocal_     = false;
+                local->cross_rank_   = false;
+                local->cross_thread_ = false;
+                findComponent(link->component_[0])->replaceLinkId(link->id_, local->id_);
+                nonlocal.erase(it);
+                delete link;
+                continue;
+            }
+            nonlocal[link->name_] = link;
+        }
+
+        if ( links_.insert(link) != link ) {
+            output.fatal(CALL_INFO, 1, "ERROR: Link %s was moved to a rank that already has a link with the same ID\n",
+                link->name_.c_str());
+        }
+    }
+    graph.links_.clear();
+
+    for ( auto& [name, group] : graph.stats_config_->groups ) {
+        std::vector<ComponentId_t> ids;
+        for ( ComponentId_t id : group.components ) {
+            if ( new_id.count(COMPONENT_ID_MASK(id)) ) ids.push_back(remap(id));
+        }
+        if ( ids.empty() ) continue;
+
+        auto it = stats_config_->groups.find(name);
+        if ( it == stats_config_->groups.end() ) {
+            it = stats_config_->groups.emplace(name, group).first;
+            it->second.components.clear();
+        }
+        it->second.components.insert(it->second.components.end(), ids.begin(), ids.end());
+    }
+}
+
 SimTime_t
 ConfigGraph::getMinimumPartitionLatency()
 {
@@ -810,7 +1173,7 @@ ConfigGraph::getCollapsedPartitionGraph()
             for ( LinkId_t id : comp->allLinks() ) {
                 const ConfigLink* link = links_[id];
 
-                if ( group.find(COMPONENT_ID_MASK(link->component_[0])) == group.end() ||
+                if ( link->nonlocal_ || group.find(COMPONENT_ID_MASK(link->component_[0])) == group.end() ||
                      group.find(COMPONENT_ID_MASK(link->component_[1])) == group.end() ) {
                     pcomp->links.push_back(link->id_);
                 }
@@ -841,7 +1204,8 @@ ConfigGraph::getCollapsedPartitionGraph()
         for ( LinkIdMap_t::iterator j = pcomp->links.begin(); j != pcomp->links.end(); ++j ) {
             PartitionLink& plink = plinks[*j];
             if ( pcomp->group.contains(plink.component_[0]) ) plink.component_[0] = pcomp->id;
-            if ( pcomp->group.contains(plink.component_[1]) ) plink.component_[1] = pcomp->id;
+            if ( !links_[*j]->nonlocal_ && pcomp->group.contains(plink.component_[1]) )
+                plink.component_[1] = pcomp->id;
         }
     }
 
@@ -876,8 +1240,9 @@ ConfigGraph::getConnectedNoCutComps(ComponentId_t start, std::set<ComponentId_t>
         ConfigLink* link = links_[id];
 
         // If this is a no_cut link, need to follow it to next
-        // component if next component is not already in group
-        if ( link->no_cut_ ) {
+        // component if next component is not already in group.
+        // Non-local links have no component on the other end.
+        if ( link->no_cut_ && !link->nonlocal_ ) {
             ComponentId_t id = COMPONENT_ID_MASK(
                 (COMPONENT_ID_MASK(link->component_[0]) == COMPONENT_ID_MASK(start) ? link->component_[1]
                                                                                     : link->component_[0]));
@@ -68,6 +68,21 @@ using VariableMap_t            = std::map<std::string, std::string>;
 
 class PartitionGraph;
 
+/**
+   Estimated memory used by a ConfigGraph.  Component bytes include
+   the subcomponents, params, statistics and port modules of each
+   component.  Interned strings are shared across the process and are
+   reported separately.
+ */
+struct ConfigGraphMemoryUsage
+{
+    uint64_t num_components        = 0;
+    uint64_t num_links             = 0;
+    uint64_t component_bytes       = 0;
+    uint64_t link_bytes            = 0;
+    uint64_t interned_string_bytes = 0;
+};
+
 
 /** A Configuration Graph
  *  A graph representing Components and Links
@@ -99,6 +114,9 @@ public:
 
     size_t getNumComponentsInMPIRank(uint32_t rank);
 
+    /** Estimate the memory used by the components and links in the graph */
+    ConfigGraphMemoryUsage getMemoryUsage() const;
+
     /** Helper function to set all the ranks to the same value */
     void setComponentRanks(RankInfo rank);
     /** Checks to see if rank contains at least one component */
@@ -110,6 +128,31 @@ public:
     /** Create a new component */
     ComponentId_t addComponent(const std::string& name, const std::string& type);
 
+    /**
+       Add a component that was created outside of the graph, such as
+       one read back from a file.  The component keeps its ID and the
+       graph takes ownership of it.  Components should be inserted in
+       order of ID.
+    */
+    void insertComponent(ConfigComponent* comp);
+
+    /**
+       Set the ID that addComponent() will give to the next component.
+       Used by models that only create part of the graph, so that the
+       components get the same IDs they would have in the full graph.
+    */
+    void setNextComponentId(ComponentId_t id) { nextComponentId = id; }
+
+    /**
+       Add a link that was created outside of the graph, such as one
+       read back from a file.  The link keeps its ID and the graph
+       takes ownership of it.  Links should be inserted in order of ID.
+    */
+    void insertLink(ConfigLink* link);
+
+    /** Replace the statistics configuration.  The graph takes ownership of config */
+    void setStatsConfig(StatsConfig* config);
+
     /** Add a parameter to a shared param set */
     void addSharedParam(const std::string& shared_set, const std::string& key, const std::string& value);
 
@@ -182,6 +225,17 @@ public:
     ConfigGraph* splitGraph(const std::set<uint32_t>& orig_rank_set, const std::set<uint32_t>& new_rank_set);
     void         reduceGraphToSingleRank(uint32_t rank);
 
+    /**
+       Moves components whose rank was changed by the partitioner to
+       that rank.  Only used with parallel load and must be called on
+       every rank.  Links between components that end up on the same
+       rank are joined into local links, and the remote rank and thread
+       of the remaining nonlocal links are updated.  Since component
+       IDs are only unique on each rank, a moved component gets a new
+       ID if its ID is already used on the new rank.
+    */
+    void redistributeComponents(uint32_t my_rank, uint32_t num_ranks);
+
     SimTime_t getMinimumPartitionLatency();
 
     PartitionGraph* getPartitionGraph();
@@ -261,12 +315,20 @@ private:
     ConfigComponentMap_t     comps_;         // SparseVectorMap
     ConfigComponentNameMap_t comps_by_name_; // std::map
 
-    std::map<std::string, LinkId_t> link_names_;
-
     StatsConfig* stats_config_;
 
     ImplementSerializable(SST::ConfigGraph)
 
+    static size_t getComponentMemoryUsage(const ConfigComponent* comp);
+
+    /**
+       Takes the components and links of graph, which was sent from
+       another rank by redistributeComponents().  nonlocal holds the
+       nonlocal links of this graph by name and is used to join links
+       whose other end is already here.
+    */
+    void mergeGraph(ConfigGraph& graph, std::map<std::string, ConfigLink*>& nonlocal);
+
     // Filter class
     class GraphFilter
     {
@@ -14,6 +14,7 @@
 #ifndef SST_CORE_MODEL_CONFIGLINK_H
 #define SST_CORE_MODEL_CONFIGLINK_H
 
+#include "sst/core/model/internedString.h"
 #include "sst/core/rankInfo.h"
 #include "sst/core/sst_types.h"
 
@@ -101,9 +102,10 @@ public:
 
     /**
        Name of the ports the link is connected to.  The indices match
-       the ones used in the component array
+       the ones used in the component array.  Port names repeat across
+       many links, so they are interned.
     */
-    std::string port_[2];
+    InternedString port_[2];
 
     /**
        Whether or not this link is set to be no-cut
@@ -155,6 +157,14 @@ public:
     */
     std::string latency_str(uint32_t index) const;
 
+    /**
+       Gets the index that is stored in latency[] during graph construction for the given latency string.  Used when
+       links are created outside of ConfigGraph, such as when they are read back from a file.
+
+       @see latency_
+    */
+    static uint32_t getLatencyIndex(const std::string& latency) { return getIndexForLatency(latency.c_str()); }
+
     /**
        Sets the link as a non-local link.  After the call, the local information will be held in index 0 of the various
        arrays, regardless of which component index holds the local information before the call.
@@ -223,6 +233,8 @@ public:
     ComponentId_t component_[2];
     SimTime_t     latency_[2];
     bool          no_cut_;
+    /** Number of events measured on this link by a previous run (see PartitionWeights) */
+    uint64_t      traffic_;
 
     PartitionLink(const ConfigLink& cl)
     {
@@ -232,6 +244,7 @@ public:
         latency_[0]   = cl.latency_[0];
         latency_[1]   = cl.latency_[1];
         no_cut_       = cl.no_cut_;
+        traffic_      = 0;
     }
 
     inline LinkId_t key() const { return id_; }
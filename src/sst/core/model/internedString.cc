@@ -0,0 +1,78 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/model/internedString.h"
+
+#include <mutex>
+#include <unordered_set>
+
+namespace SST {
+
+namespace {
+
+// Function statics so that the table can be used during static
+// initialization.  Elements of an unordered_set do not move when it
+// rehashes, so pointers to them stay valid.
+std::unordered_set<std::string>&
+getTable()
+{
+    static std::unordered_set<std::string> table;
+    return table;
+}
+
+std::mutex&
+getTableLock()
+{
+    static std::mutex lock;
+    return lock;
+}
+
+} // namespace
+
+const std::string*
+InternedString::intern(const std::string& str)
+{
+    std::scoped_lock lock(getTableLock());
+    return &(*getTable().insert(str).first);
+}
+
+const std::string*
+InternedString::emptyString()
+{
+    static const std::string* empty_str = intern("");
+    return empty_str;
+}
+
+size_t
+InternedString::getTableSize()
+{
+    std::scoped_lock lock(getTableLock());
+    return getTable().size();
+}
+
+size_t
+InternedString::getTableMemoryUsage()
+{
+    std::scoped_lock lock(getTableLock());
+    auto&            table = getTable();
+    size_t           bytes = table.bucket_count() * sizeof(void*);
+    // Each entry is a hash node holding the string, the next pointer
+    // and the cached hash.  Short strings have no separate allocation.
+    for ( auto& str : table ) {
+        bytes += sizeof(std::string) + 2 * sizeof(void*);
+        if ( str.capacity() > std::string().capacity() ) bytes += str.capacity() + 1;
+    }
+    return bytes;
+}
+
+} // namespace SST
@@ -0,0 +1,112 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_MODEL_INTERNEDSTRING_H
+#define SST_CORE_MODEL_INTERNEDSTRING_H
+
+#include "sst/core/serialization/serialize.h"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace SST {
+
+/**
+   Immutable string that is stored once in a process wide table, so
+   each copy only costs a pointer.  Used by the ConfigGraph for
+   strings that repeat across many components and links, such as
+   component types and port names.  Converts implicitly to
+   const std::string&.
+*/
+class InternedString
+{
+public:
+    InternedString() :
+        str_(emptyString())
+    {}
+
+    InternedString(const std::string& str) :
+        str_(intern(str))
+    {}
+
+    InternedString(const char* str) :
+        str_(intern(str))
+    {}
+
+    const std::string& str() const { return *str_; }
+    operator const std::string&() const { return *str_; }
+
+    const char* c_str() const { return str_->c_str(); }
+    size_t      size() const { return str_->size(); }
+    bool        empty() const { return str_->empty(); }
+    void        clear() { str_ = emptyString(); }
+
+    /** Interned strings are equal if they point to the same entry in the table */
+    bool operator==(const InternedString& other) const { return str_ == other.str_; }
+    bool operator!=(const InternedString& other) const { return str_ != other.str_; }
+    bool operator<(const InternedString& other) const { return *str_ < *other.str_; }
+
+    friend bool operator==(const InternedString& lhs, const std::string& rhs) { return *lhs.str_ == rhs; }
+    friend bool operator==(const std::string& lhs, const InternedString& rhs) { return lhs == *rhs.str_; }
+    friend bool operator==(const InternedString& lhs, const char* rhs) { return *lhs.str_ == rhs; }
+    friend bool operator!=(const InternedString& lhs, const std::string& rhs) { return *lhs.str_ != rhs; }
+    friend bool operator!=(const std::string& lhs, const InternedString& rhs) { return lhs != *rhs.str_; }
+    friend bool operator!=(const InternedString& lhs, const char* rhs) { return *lhs.str_ != rhs; }
+
+    friend std::ostream& operator<<(std::ostream& os, const InternedString& str) { return os << *str.str_; }
+
+    /** Returns the number of unique strings in the table */
+    static size_t getTableSize();
+
+    /** Returns the approximate number of bytes used by the table */
+    static size_t getTableMemoryUsage();
+
+private:
+    const std::string* str_;
+
+    static const std::string* intern(const std::string& str);
+    static const std::string* emptyString();
+};
+
+} // namespace SST
+
+namespace SST::Core::Serialization {
+
+template <>
+class serialize_impl<SST::InternedString>
+{
+public:
+    void operator()(SST::InternedString& str, serializer& ser, ser_opt_t options)
+    {
+        switch ( ser.mode() ) {
+        case serializer::SIZER:
+        case serializer::PACK:
+            // Packing does not modify the string
+            SST_SER(const_cast<std::string&>(str.str()), options);
+            break;
+        case serializer::UNPACK:
+        {
+            std::string tmp;
+            SST_SER(tmp, options);
+            str = tmp;
+            break;
+        }
+        case serializer::MAP:
+            // Interned strings are not mapped
+            break;
+        }
+    }
+};
+
+} // namespace SST::Core::Serialization
+
+#endif // SST_CORE_MODEL_INTERNEDSTRING_H
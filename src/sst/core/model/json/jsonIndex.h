@@ -0,0 +1,83 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_MODEL_JSON_JSONINDEX_H
+#define SST_CORE_MODEL_JSON_JSONINDEX_H
+
+#include "sst/core/sst_types.h"
+
+#include <cstdint>
+#include <string>
+
+/**
+   Layout of the sidecar index written next to a JSON file by
+   --output-json when --output-json-index is given.  The index is named by appending indexSuffix to the
+   name of the JSON file.
+
+   The index gives the byte range of the section of the JSON file
+   before the components, of the statistics groups and of every
+   component and link record.  A parallel load of a single JSON file
+   uses it to parse only the records for the components on the rank,
+   plus the links attached to them, instead of having every rank parse
+   the whole file.
+
+   The file starts with a Header, followed by num_components
+   ComponentEntry and num_links LinkEntry.  Values are stored in the
+   native byte order.
+ */
+namespace SST::Core::JSONIndex {
+
+constexpr char     magic[8]      = { 'S', 'S', 'T', 'J', 'S', 'I', 'D', 'X' };
+constexpr uint32_t version       = 1;
+constexpr char     indexSuffix[] = ".idx";
+
+/** Used for the component of the remote side of nonlocal links */
+constexpr uint64_t no_component = UINT64_MAX;
+
+struct Header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t json_size; /*!< Size of the JSON file, used to detect a stale index */
+    uint64_t num_components;
+    uint64_t num_links;
+    uint64_t preamble_size; /*!< Bytes from the start of the file to the components section */
+    uint64_t stat_groups_offset; /*!< Location of the statistics_group section */
+    uint64_t stat_groups_size;
+};
+
+/** Index entry for a component record.  Entries are in file order. */
+struct ComponentEntry
+{
+    uint64_t offset;
+    uint64_t size;
+    /** Partition of the component, or RankInfo::UNASSIGNED if the file has no partition information */
+    uint32_t rank;
+    uint32_t thread;
+};
+
+/** Index entry for a link record */
+struct LinkEntry
+{
+    uint64_t offset;
+    uint64_t size;
+    /**
+       Position in the component index of the top level component on
+       each end of the link.  For nonlocal links, component[1] is
+       no_component.
+    */
+    uint64_t component[2];
+};
+
+} // namespace SST::Core::JSONIndex
+
+#endif // SST_CORE_MODEL_JSON_JSONINDEX_H
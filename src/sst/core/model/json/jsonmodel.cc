@@ -15,9 +15,20 @@
 
 #include "sst/core/model/json/jsonmodel.h"
 
+#include "sst/core/model/json/jsonIndex.h"
+#include "sst/core/sst_mpi.h"
+
+#include <cctype>
+#include <cerrno>
+#include <cinttypes>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <fcntl.h>
 #include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <utility>
 
 DISABLE_WARN_STRICT_ALIASING
@@ -474,6 +485,8 @@ SSTConfigSaxHandler::string(std::string& val)
         break;
     case State::Link_Left:
         if ( current_key_ == "component" ) {
+            // This side of the link is on a component that was not loaded
+            if ( remote_side_ == 0 ) break;
             bool success;
             shadow_link_.leftcomp = findComponentIdByName(val, success);
             if ( !success ) {
@@ -498,6 +511,8 @@ SSTConfigSaxHandler::string(std::string& val)
         break;
     case State::Link_Right:
         if ( current_key_ == "component" ) {
+            // This side of the link is on a component that was not loaded
+            if ( remote_side_ == 1 ) break;
             bool success;
             shadow_link_.rightcomp = findComponentIdByName(val, success);
             if ( !success ) {
@@ -554,15 +569,18 @@ SSTConfigSaxHandler::string(std::string& val)
         break;
     case State::StatGroup_CompArray:
     {
-        bool success = false;
-        current_stat_group_->addComponent(findComponentIdByName(val, success));
+        bool          success = false;
+        ComponentId_t id      = findComponentIdByName(val, success);
         if ( !success ) {
+            // Components on other ranks are not loaded for partial loads
+            if ( partial_load_ ) break;
             error_str_ =
                 "Error: Unable to locate component ID for component '" + val +
                 "' in statistics group component list for group " + current_stat_group_->name +
                 ". Ensure components are declared prior to adding them to a statistic group in your input file.";
             return false;
         }
+        current_stat_group_->addComponent(id);
         break;
     }
     case State::SharedParams_object:
@@ -764,14 +782,27 @@ SSTConfigSaxHandler::end_object()
     {
         LinkId_t id = graph_->createLink(shadow_link_.name.c_str(), nullptr);
         if ( shadow_link_.nocut ) graph_->setLinkNoCut(id);
-        graph_->addLink(shadow_link_.leftcomp, id, shadow_link_.leftport.c_str(), shadow_link_.leftlat.c_str());
 
-        if ( shadow_link_.nonlocal ) {
-            graph_->addNonLocalLink(id, shadow_link_.rank, shadow_link_.thread);
+        if ( remote_side_ == 0 ) {
+            // Only the right side was loaded
+            graph_->addLink(shadow_link_.rightcomp, id, shadow_link_.rightport.c_str(), shadow_link_.rightlat.c_str());
+            graph_->addNonLocalLink(id, remote_rank_.rank, remote_rank_.thread);
         }
         else {
-            graph_->addLink(shadow_link_.rightcomp, id, shadow_link_.rightport.c_str(), shadow_link_.rightlat.c_str());
+            graph_->addLink(shadow_link_.leftcomp, id, shadow_link_.leftport.c_str(), shadow_link_.leftlat.c_str());
+
+            if ( shadow_link_.nonlocal ) {
+                graph_->addNonLocalLink(id, shadow_link_.rank, shadow_link_.thread);
+            }
+            else if ( remote_side_ == 1 ) {
+                graph_->addNonLocalLink(id, remote_rank_.rank, remote_rank_.thread);
+            }
+            else {
+                graph_->addLink(
+                    shadow_link_.rightcomp, id, shadow_link_.rightport.c_str(), shadow_link_.rightlat.c_str());
+            }
         }
+        remote_side_ = -1;
         shadow_link_.reset();
         break;
     }
@@ -1132,6 +1163,13 @@ SSTConfigSaxHandler::setConfigGraph(ConfigGraph* graph)
     graph_ = graph;
 }
 
+void
+SSTConfigSaxHandler::setRemoteLinkSide(int side, RankInfo rank)
+{
+    remote_side_ = side;
+    remote_rank_ = rank;
+}
+
 bool
 SSTConfigSaxHandler::parse_error(std::size_t position, const std::string& last_token, const json::exception& ex)
 {
@@ -1161,27 +1199,190 @@ SSTJSONModelDefinition::SSTJSONModelDefinition(
 
 SSTJSONModelDefinition::~SSTJSONModelDefinition()
 {
+    if ( data_ ) munmap(data_, size_);
     delete output_;
 }
 
-ConfigGraph*
-SSTJSONModelDefinition::createConfigGraph()
+void
+SSTJSONModelDefinition::parseRange(SSTConfigSaxHandler& handler, uint64_t offset, uint64_t size)
+{
+    if ( offset > size_ || size > size_ - offset ) {
+        output_->fatal(CALL_INFO, 1, "Index for JSON file %s does not match the file\n", script_name_.c_str());
+    }
+    const char* begin = data_ + offset;
+    if ( !json::sax_parse(begin, begin + size, &handler) ) {
+        output_->fatal(CALL_INFO, 1, "Error parsing json file at position %" PRIu64 ": (%s)\n",
+            offset + handler.error_pos_, handler.error_str_.c_str());
+    }
+}
+
+void
+SSTJSONModelDefinition::parseSection(SSTConfigSaxHandler& handler, uint64_t offset, uint64_t size)
+{
+    if ( offset > size_ || size > size_ - offset ) {
+        output_->fatal(CALL_INFO, 1, "Index for JSON file %s does not match the file\n", script_name_.c_str());
+    }
+    std::string text(data_ + offset, size);
+    while ( !text.empty() && (std::isspace(static_cast<unsigned char>(text.back())) || text.back() == ',') ) {
+        text.pop_back();
+    }
+    // The preamble already starts with the opening brace
+    if ( text.empty() || text.front() != '{' ) text.insert(0, "{");
+    text += "}";
+
+    handler.setState(State::Entry);
+    if ( !json::sax_parse(text, &handler) ) {
+        output_->fatal(CALL_INFO, 1, "Error parsing json file near position %" PRIu64 ": (%s)\n", offset,
+            handler.error_str_.c_str());
+    }
+}
+
+bool
+SSTJSONModelDefinition::loadFromIndex(SSTConfigSaxHandler& handler)
 {
-    // open the file
-    std::ifstream ifs(script_name_.c_str());
-    if ( !ifs.is_open() ) {
+    std::string   index_name = script_name_ + JSONIndex::indexSuffix;
+    std::ifstream index(index_name, std::ios::binary);
+    if ( !index.is_open() ) {
+        output_->verbose(CALL_INFO, 1, 0,
+            "No index found for %s (written by --output-json-index), every rank will parse the whole file\n",
+            script_name_.c_str());
+        return false;
+    }
+
+    JSONIndex::Header header;
+    if ( !index.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+         memcmp(header.magic, JSONIndex::magic, sizeof(JSONIndex::magic)) != 0 ||
+         header.version != JSONIndex::version ) {
+        output_->output("WARNING: %s is not a valid JSON index, every rank will parse the whole file\n",
+            index_name.c_str());
+        return false;
+    }
+
+    int fd = open(script_name_.c_str(), O_RDONLY);
+    if ( fd < 0 ) {
         output_->fatal(CALL_INFO, 1, "Error opening JSON model from script: %s\n", script_name_.c_str());
-        return nullptr;
     }
+    struct stat st;
+    if ( fstat(fd, &st) != 0 || static_cast<uint64_t>(st.st_size) != header.json_size ) {
+        close(fd);
+        output_->output("WARNING: Index %s does not match %s, every rank will parse the whole file\n",
+            index_name.c_str(), script_name_.c_str());
+        return false;
+    }
+
+    std::vector<JSONIndex::ComponentEntry> comps(header.num_components);
+    std::vector<JSONIndex::LinkEntry>      links(header.num_links);
+    index.read(reinterpret_cast<char*>(comps.data()), comps.size() * sizeof(JSONIndex::ComponentEntry));
+    index.read(reinterpret_cast<char*>(links.data()), links.size() * sizeof(JSONIndex::LinkEntry));
+    if ( !index ) {
+        close(fd);
+        output_->fatal(CALL_INFO, 1, "JSON index %s is truncated\n", index_name.c_str());
+    }
+
+    size_ = st.st_size;
+
+    // Only the parts of the file this rank needs will be paged in
+    void* addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if ( addr == MAP_FAILED ) {
+        output_->fatal(CALL_INFO, 1, "Unable to map JSON file [%s]: %s\n", script_name_.c_str(), strerror(errno));
+    }
+    data_ = static_cast<char*>(addr);
+
+    // Find the partition of every component.  Files written without
+    // partition information are split into equal blocks of components.
+    const RankInfo        world(config_->num_ranks(), config_->num_threads());
+    const uint32_t        my_rank        = SST_MPI_GetRank();
+    const uint64_t        num_partitions = static_cast<uint64_t>(world.rank) * world.thread;
+    std::vector<RankInfo> partition(comps.size());
+    for ( uint64_t i = 0; i < comps.size(); ++i ) {
+        if ( comps[i].rank == RankInfo::UNASSIGNED ) {
+            uint64_t part = i * num_partitions / comps.size();
+            partition[i]  = RankInfo(part / world.thread, part % world.thread);
+        }
+        else if ( comps[i].rank >= world.rank || comps[i].thread >= world.thread ) {
+            output_->fatal(CALL_INFO, 1,
+                "JSON file %s was partitioned for more ranks or threads than are in use and can not be loaded in "
+                "parallel\n",
+                script_name_.c_str());
+        }
+        else {
+            partition[i] = RankInfo(comps[i].rank, comps[i].thread);
+        }
+    }
+
+    handler.setPartialLoad(true);
+
+    // Program options, shared params and statistics options
+    parseSection(handler, 0, header.preamble_size);
+
+    // Components are given the IDs they would get if the whole file
+    // was parsed
+    uint64_t comp_count = 0;
+    handler.setState(State::CompArray);
+    for ( uint64_t i = 0; i < comps.size(); ++i ) {
+        if ( partition[i].rank != my_rank ) continue;
+        graph_->setNextComponentId(i);
+        parseRange(handler, comps[i].offset, comps[i].size);
+        graph_->findComponent(i)->setRank(partition[i]);
+        comp_count++;
+    }
+
+    parseSection(handler, header.stat_groups_offset, header.stat_groups_size);
+
+    uint64_t link_count = 0;
+    handler.setState(State::LinkArray);
+    for ( const auto& entry : links ) {
+        const bool nonlocal = entry.component[1] == JSONIndex::no_component;
+        const bool local0   = partition.at(entry.component[0]).rank == my_rank;
+        const bool local1   = !nonlocal && partition.at(entry.component[1]).rank == my_rank;
+        if ( !local0 && !local1 ) continue;
 
+        if ( !nonlocal && local0 != local1 ) {
+            const int remote = local0 ? 1 : 0;
+            handler.setRemoteLinkSide(remote, partition[entry.component[remote]]);
+        }
+        parseRange(handler, entry.offset, entry.size);
+        link_count++;
+    }
+
+    output_->verbose(CALL_INFO, 1, 0,
+        "Loaded %" PRIu64 " of %" PRIu64 " components and %" PRIu64 " of %" PRIu64 " links from %s\n", comp_count,
+        header.num_components, link_count, header.num_links, script_name_.c_str());
+    return true;
+}
+
+ConfigGraph*
+SSTJSONModelDefinition::createConfigGraph()
+{
     // create the SAX handler
     SSTConfigSaxHandler handler;
     handler.setConfigGraph(graph_);
-    bool result = json::sax_parse(ifs, &handler);
-    if ( !result ) {
-        output_->fatal(CALL_INFO, 1, "Error parsing json file at position %lu: (%s)\n", handler.error_pos_,
-            handler.error_str_.c_str());
-        return nullptr;
+
+    // When a single file is loaded in parallel, each rank only parses
+    // its own part of the file if the file has an index
+    bool loaded = false;
+    if ( config_->parallel_load() && !config_->parallel_load_mode_multi() && config_->num_ranks() > 1 ) {
+        loaded = loadFromIndex(handler);
+    }
+
+    if ( !loaded ) {
+        // open the file
+        std::ifstream ifs(script_name_.c_str());
+        if ( !ifs.is_open() ) {
+            output_->fatal(CALL_INFO, 1, "Error opening JSON model from script: %s\n", script_name_.c_str());
+            return nullptr;
+        }
+
+        bool result = json::sax_parse(ifs, &handler);
+        if ( !result ) {
+            output_->fatal(CALL_INFO, 1, "Error parsing json file at position %lu: (%s)\n", handler.error_pos_,
+                handler.error_str_.c_str());
+            return nullptr;
+        }
+
+        // close the file
+        ifs.close();
     }
 
     // set the program options
@@ -1190,7 +1391,5 @@ SSTJSONModelDefinition::createConfigGraph()
         setOptionFromModel(key, value);
     }
 
-    // close the file
-    ifs.close();
     return graph_;
 }
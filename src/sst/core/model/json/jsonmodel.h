@@ -64,8 +64,32 @@ public:
     void setConfigGraph(ConfigGraph* graph);
     const std::map<std::string, std::string> getProgramOptions();
 
+    /**
+       Set the parser state.  Used to parse a single record from the
+       middle of a file, such as a component or link found through a
+       JSONIndex.
+    */
+    void setState(State state) { current_state_ = state; }
+
+    /**
+       Used when only part of the graph is loaded.  Statistics groups
+       then skip components that were not loaded.
+    */
+    void setPartialLoad(bool partial) { partial_load_ = partial; }
+
+    /**
+       Marks one side of the next link as connected to a component
+       that was not loaded.  The link is added as a nonlocal link to
+       the given rank.
+
+       @param side 0 for the left side of the link, 1 for the right side
+
+       @param rank Rank and thread of the component that was not loaded
+    */
+    void setRemoteLinkSide(int side, RankInfo rank);
+
     // error state
-    std::size_t error_pos_;
+    std::size_t error_pos_ = 0;
     std::string error_str_;
 
 private:
@@ -170,6 +194,10 @@ private:
 
     bool found_components_ = false; // components must be declared before links
 
+    bool     partial_load_ = false;
+    int      remote_side_  = -1; // Side of the current link that was not loaded, if any
+    RankInfo remote_rank_;
+
     ComponentId_t findComponentIdByName(const std::string& name, bool& success);
 };
 
@@ -197,6 +225,29 @@ protected:
     Config*      config_;
     ConfigGraph* graph_;
     double       start_time_;
+
+private:
+    // Mapping of the JSON file for loads that use the index
+    char*  data_ = nullptr;
+    size_t size_ = 0;
+
+    /**
+       Load only the part of the graph that belongs on this rank,
+       using the index written next to the JSON file by --output-json.
+
+       @return false if there is no usable index, in which case the
+       whole file needs to be parsed
+    */
+    bool loadFromIndex(SSTConfigSaxHandler& handler);
+
+    /** Parse the records in [offset, offset + size) of the mapped file */
+    void parseRange(SSTConfigSaxHandler& handler, uint64_t offset, uint64_t size);
+
+    /**
+       Parse a section of the top-level object.  The text is wrapped in
+       braces after removing any trailing comma.
+    */
+    void parseSection(SSTConfigSaxHandler& handler, uint64_t offset, uint64_t size);
 };
 
 } // namespace SST::Core
@@ -0,0 +1,171 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/model/partitionWeights.h"
+
+#include "sst/core/model/configComponent.h"
+#include "sst/core/model/configGraph.h"
+#include "sst/core/model/configLink.h"
+#include "sst/core/simulation.h"
+#include "sst/core/stringize.h"
+#include "sst/core/util/filesystem.h"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace SST {
+
+namespace {
+
+// Measured components never get less than this fraction of the
+// average weight, which accounts for memory and other costs that
+// aren't captured by handler time
+constexpr double min_relative_weight = 0.01;
+
+const char* const file_header = "# SST partition weights";
+
+} // anonymous namespace
+
+void
+PartitionWeights::addCost(const std::string& comp_name, uint64_t time)
+{
+    // Subcomponent costs are charged to the parent component, since
+    // that is what gets partitioned
+    comp_cost[comp_name.substr(0, comp_name.find(':'))] += time;
+}
+
+void
+PartitionWeights::addTraffic(const std::string& comp_name, const std::string& port, uint64_t count)
+{
+    port_traffic[comp_name][port] += count;
+}
+
+void
+PartitionWeights::merge(const PartitionWeights& other)
+{
+    for ( auto& [name, cost] : other.comp_cost ) {
+        comp_cost[name] += cost;
+    }
+    for ( auto& [name, ports] : other.port_traffic ) {
+        for ( auto& [port, count] : ports ) {
+            port_traffic[name][port] += count;
+        }
+    }
+}
+
+bool
+PartitionWeights::writeFile(const std::string& filename) const
+{
+    std::ofstream out = Simulation::filesystem.ofstream(filename);
+    if ( !out.is_open() ) return false;
+
+    // Names go last on each line and fields are tab separated so that
+    // names are read back unchanged
+    out << file_header << "\n";
+    for ( auto& [name, cost] : comp_cost ) {
+        out << "component\t" << cost << "\t" << name << "\n";
+    }
+    for ( auto& [name, ports] : port_traffic ) {
+        for ( auto& [port, count] : ports ) {
+            out << "traffic\t" << count << "\t" << port << "\t" << name << "\n";
+        }
+    }
+    return out.good();
+}
+
+bool
+PartitionWeights::readFile(const std::string& filename)
+{
+    std::ifstream in(filename);
+    if ( !in.is_open() ) return false;
+
+    std::string line;
+    if ( !std::getline(in, line) || line != file_header ) return false;
+
+    std::vector<std::string> fields;
+    while ( std::getline(in, line) ) {
+        if ( line.empty() || line[0] == '#' ) continue;
+
+        fields.clear();
+        tokenize(fields, line, "\t", false);
+
+        try {
+            if ( fields.size() == 3 && fields[0] == "component" ) {
+                comp_cost[fields[2]] += std::stoull(fields[1]);
+            }
+            else if ( fields.size() == 4 && fields[0] == "traffic" ) {
+                port_traffic[fields[3]][fields[2]] += std::stoull(fields[1]);
+            }
+            else {
+                return false;
+            }
+        }
+        catch ( const std::exception& e ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t
+PartitionWeights::applyComponentWeights(ConfigGraph* graph) const
+{
+    std::vector<std::pair<ConfigComponent*, uint64_t>> measured;
+    measured.reserve(comp_cost.size());
+
+    double total = 0.0;
+    for ( auto& [name, cost] : comp_cost ) {
+        ConfigComponent* comp = graph->findComponentByName(name);
+        if ( nullptr == comp ) continue;
+        measured.emplace_back(comp, cost);
+        total += cost;
+    }
+    if ( measured.empty() || total <= 0.0 ) return 0;
+
+    const double average = total / measured.size();
+    for ( auto& [comp, cost] : measured ) {
+        comp->setWeight(std::max(cost / average, min_relative_weight));
+    }
+    return measured.size();
+}
+
+size_t
+PartitionWeights::applyLinkTraffic(ConfigGraph* graph, PartitionGraph* pgraph) const
+{
+    ConfigLinkMap_t&    links  = graph->getLinkMap();
+    PartitionLinkMap_t& plinks = pgraph->getLinkMap();
+
+    size_t count = 0;
+    for ( auto& [name, ports] : port_traffic ) {
+        ConfigComponent* comp = graph->findComponentByName(name);
+        if ( nullptr == comp ) continue;
+
+        for ( LinkId_t id : comp->links ) {
+            ConfigLink* link = links[id];
+            for ( int i = 0; i < 2; i++ ) {
+                if ( link->component_[i] != comp->id ) continue;
+
+                auto port = ports.find(link->port_[i]);
+                if ( port == ports.end() || !plinks.contains(id) ) continue;
+
+                plinks[id].traffic_ += port->second;
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+} // namespace SST
@@ -0,0 +1,97 @@
+// -*- c++ -*-
+
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_MODEL_PARTITIONWEIGHTS_H
+#define SST_CORE_MODEL_PARTITIONWEIGHTS_H
+
+#include "sst/core/serialization/serialize.h"
+#include "sst/core/sst_types.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace SST {
+
+class ConfigGraph;
+class PartitionGraph;
+
+/**
+   Component costs and link traffic measured during a simulation run.
+
+   The data is collected by the partition profile tools (enabled with
+   --output-partition-weights) and written to a file at the end of the
+   run.  A later run can read the file using --partition-weights to
+   set the component and link weights used by the partitioner.
+*/
+class PartitionWeights
+{
+public:
+    /** Time in nanoseconds spent in handlers, keyed by component name */
+    std::map<std::string, uint64_t> comp_cost;
+
+    /**
+       Number of events received on each port, keyed by
+       (sub)component name and then port name
+    */
+    std::map<std::string, std::map<std::string, uint64_t>> port_traffic;
+
+    /** Adds the cost of a handler to the component that owns it */
+    void addCost(const std::string& comp_name, uint64_t time);
+
+    /** Adds events received on a port */
+    void addTraffic(const std::string& comp_name, const std::string& port, uint64_t count);
+
+    /** Adds all the data from another PartitionWeights object */
+    void merge(const PartitionWeights& other);
+
+    bool empty() const { return comp_cost.empty() && port_traffic.empty(); }
+
+    /**
+       Writes the weights to a text file.  Returns false if the file
+       could not be written.
+    */
+    bool writeFile(const std::string& filename) const;
+
+    /**
+       Reads weights from a file created by writeFile().  Returns false
+       if the file could not be read.
+    */
+    bool readFile(const std::string& filename);
+
+    /**
+       Sets the weight of each component in the graph to its measured
+       cost relative to the average cost.  Components without a
+       measured cost are left unchanged.  Returns the number of
+       components that were updated.
+    */
+    size_t applyComponentWeights(ConfigGraph* graph) const;
+
+    /**
+       Sets the traffic for each link in the partition graph.  The
+       names of the components and ports are looked up in graph, which
+       must be the graph pgraph was created from.  Returns the number
+       of links that were updated.
+    */
+    size_t applyLinkTraffic(ConfigGraph* graph, PartitionGraph* pgraph) const;
+
+    void serialize_order(SST::Core::Serialization::serializer& ser)
+    {
+        SST_SER(comp_cost);
+        SST_SER(port_traffic);
+    }
+};
+
+} // namespace SST
+
+#endif // SST_CORE_MODEL_PARTITIONWEIGHTS_H
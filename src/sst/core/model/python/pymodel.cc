@@ -19,6 +19,7 @@
 #include "sst/core/cputimer.h"
 #include "sst/core/factory.h"
 #include "sst/core/from_string.h"
+#include "sst/core/graphGenerator.h"
 #include "sst/core/memuse.h"
 #include "sst/core/model/configGraph.h"
 #include "sst/core/model/element_python.h"
@@ -42,7 +43,14 @@ REENABLE_WARNING
 
 #include "sst/core/sst_mpi.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cinttypes>
+#include <map>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 DISABLE_WARN_STRICT_ALIASING
 
@@ -350,6 +358,8 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
         SST_ConvertToPythonString(cfg->output_config_graph().c_str()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("output-json"), SST_ConvertToPythonString(cfg->output_json().c_str()));
+    PyDict_SetItem(dict, SST_ConvertToPythonString("output-binary-graph"),
+        SST_ConvertToPythonString(cfg->output_binary_graph().c_str()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("parallel-output"), SST_ConvertToPythonBool(cfg->parallel_output()));
 
     // Graph output options
@@ -915,6 +925,17 @@ addSharedParams(PyObject* UNUSED(self), PyObject* args)
     return SST_ConvertToPythonLong(count);
 }
 
+static PyObject*
+enableSharedParamsCache(PyObject* UNUSED(self), PyObject* args)
+{
+    char* set    = nullptr;
+    int   enable = 1;
+    if ( !PyArg_ParseTuple(args, "s|p", &set, &enable) ) return nullptr;
+
+    gModel->enableSharedParamsCache(set, enable);
+    Py_RETURN_NONE;
+}
+
 static PyObject*
 getElapsedExecutionTime(PyObject* UNUSED(self), PyObject* UNUSED(args))
 {
@@ -941,6 +962,391 @@ getLocalMemoryUsage(PyObject* UNUSED(self), PyObject* UNUSED(args))
     return res;
 }
 
+// Reads a list of component ids for the bulk construction functions.
+// obj is either an object supporting the buffer protocol with a one
+// dimensional array of integers (e.g. array.array or numpy arrays) or
+// a sequence of integers and Component/SubComponent objects.  Returns
+// false with a Python exception set on error.
+static bool
+getComponentIdArray(PyObject* obj, const char* arg_name, std::vector<ComponentId_t>& ids)
+{
+    ids.clear();
+    if ( PyObject_CheckBuffer(obj) ) {
+        Py_buffer view;
+        if ( PyObject_GetBuffer(obj, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) != 0 ) return false;
+
+        // Only native byte order integers are supported
+        const char* format = view.format ? view.format : "B";
+        if ( *format == '@' || *format == '=' ) format++;
+        const char code    = *format;
+        const bool integer = code != '\0' && format[1] == '\0' && strchr("bBhHiIlLqQnN", code) != nullptr;
+        if ( view.ndim > 1 || !integer ) {
+            PyErr_Format(PyExc_TypeError, "%s must be a one dimensional array of integers", arg_name);
+            PyBuffer_Release(&view);
+            return false;
+        }
+
+        const bool  is_signed = islower(code);
+        const char* data      = static_cast<const char*>(view.buf);
+        const auto  count     = view.len / view.itemsize;
+        ids.reserve(count);
+        for ( Py_ssize_t i = 0; i < count; ++i ) {
+            const char* item = data + i * view.itemsize;
+            int64_t     value;
+            switch ( view.itemsize ) {
+            case 1:
+                value = is_signed ? *reinterpret_cast<const int8_t*>(item) : *reinterpret_cast<const uint8_t*>(item);
+                break;
+            case 2:
+            {
+                uint16_t v;
+                memcpy(&v, item, 2);
+                value = is_signed ? static_cast<int16_t>(v) : v;
+                break;
+            }
+            case 4:
+            {
+                uint32_t v;
+                memcpy(&v, item, 4);
+                value = is_signed ? static_cast<int32_t>(v) : v;
+                break;
+            }
+            default:
+                memcpy(&value, item, sizeof(value));
+                break;
+            }
+            if ( is_signed && value < 0 ) {
+                PyErr_Format(PyExc_ValueError, "%s contains a negative component id", arg_name);
+                PyBuffer_Release(&view);
+                return false;
+            }
+            ids.push_back(static_cast<ComponentId_t>(value));
+        }
+        PyBuffer_Release(&view);
+    }
+    else {
+        PyObject* seq = PySequence_Fast(obj, "component ids must be a sequence or an array");
+        if ( nullptr == seq ) return false;
+
+        const Py_ssize_t count = PySequence_Fast_GET_SIZE(seq);
+        PyObject**       items = PySequence_Fast_ITEMS(seq);
+        ids.reserve(count);
+        for ( Py_ssize_t i = 0; i < count; ++i ) {
+            PyObject* item = items[i];
+            if ( PyLong_Check(item) ) {
+                unsigned long long value = PyLong_AsUnsignedLongLong(item);
+                if ( PyErr_Occurred() ) {
+                    Py_DECREF(seq);
+                    return false;
+                }
+                ids.push_back(static_cast<ComponentId_t>(value));
+            }
+            else if ( PyObject_TypeCheck(item, &PyModel_ComponentType) ||
+                      PyObject_TypeCheck(item, &PyModel_SubComponentType) ) {
+                ids.push_back(getComp(item)->id);
+            }
+            else {
+                PyErr_Format(PyExc_TypeError, "%s must contain only integers or Component/SubComponent objects",
+                    arg_name);
+                Py_DECREF(seq);
+                return false;
+            }
+        }
+        Py_DECREF(seq);
+    }
+
+    // Make sure all the components exist before anything is added to
+    // the graph
+    ConfigGraph* graph = gModel->getGraph();
+    for ( ComponentId_t id : ids ) {
+        if ( !graph->containsComponent(COMPONENT_ID_MASK(id)) || nullptr == graph->findComponent(id) ) {
+            PyErr_Format(PyExc_ValueError, "%s contains unknown component id %" PRIu64, arg_name, id);
+            return false;
+        }
+    }
+    return true;
+}
+
+// Reads the ports or latencies for the bulk construction functions.
+// obj is either a single value, which is used for all count links, or
+// a sequence of count values.  Values that are not strings (for
+// example UnitAlgebra latencies) are converted with str().  Returns
+// false with a Python exception set on error.
+static bool
+getStringArray(PyObject* obj, const char* arg_name, size_t count, std::vector<std::string>& strs)
+{
+    strs.clear();
+    auto convert = [&strs](PyObject* item) {
+        PyObject* str = PyObject_Str(item);
+        if ( nullptr == str ) return false;
+        const char* value = SST_ConvertToCppString(str);
+        if ( nullptr != value ) strs.emplace_back(value);
+        Py_DECREF(str);
+        return nullptr != value;
+    };
+
+    if ( PyUnicode_Check(obj) || !PySequence_Check(obj) ) return convert(obj);
+
+    PyObject* seq = PySequence_Fast(obj, "expected a sequence");
+    if ( nullptr == seq ) return false;
+    const size_t size = PySequence_Fast_GET_SIZE(seq);
+    if ( size != count ) {
+        PyErr_Format(PyExc_ValueError, "%s has %zu entries, expected %zu", arg_name, size, count);
+        Py_DECREF(seq);
+        return false;
+    }
+    strs.reserve(count);
+    PyObject** items = PySequence_Fast_ITEMS(seq);
+    for ( size_t i = 0; i < count; ++i ) {
+        if ( !convert(items[i]) ) {
+            Py_DECREF(seq);
+            return false;
+        }
+    }
+    Py_DECREF(seq);
+    return true;
+}
+
+// Converts a dict of parameters to strings for the bulk construction
+// functions.  params may be nullptr or None.  Returns false with a
+// Python exception set on error.
+static bool
+getParamList(PyObject* params, std::vector<std::pair<std::string, std::string>>& param_list)
+{
+    if ( nullptr == params || Py_None == params ) return true;
+    if ( !PyDict_Check(params) ) {
+        PyErr_SetString(PyExc_TypeError, "params must be a dict");
+        return false;
+    }
+    PyObject*  key;
+    PyObject*  val;
+    Py_ssize_t pos = 0;
+    while ( PyDict_Next(params, &pos, &key, &val) ) {
+        PyObject* kstr = PyObject_Str(key);
+        PyObject* vstr = PyObject_Str(val);
+        // The UTF-8 conversion returns nullptr with an exception set
+        // if the string can't be encoded, e.g. for lone surrogates
+        const char* kval = nullptr != kstr ? SST_ConvertToCppString(kstr) : nullptr;
+        const char* vval = nullptr != vstr ? SST_ConvertToCppString(vstr) : nullptr;
+        const bool  ok   = nullptr != kval && nullptr != vval;
+        if ( ok ) param_list.emplace_back(kval, vval);
+        Py_XDECREF(kstr);
+        Py_XDECREF(vstr);
+        if ( !ok ) return false;
+    }
+    return true;
+}
+
+static PyObject*
+createComponents(PyObject* UNUSED(self), PyObject* args)
+{
+    char*      name_prefix = nullptr;
+    char*      type        = nullptr;
+    Py_ssize_t count       = 0;
+    PyObject*  params      = nullptr;
+    char*      shared_set  = nullptr;
+
+    PyErr_Clear();
+
+    if ( !PyArg_ParseTuple(args, "ssn|Oz", &name_prefix, &type, &count, &params, &shared_set) ) return nullptr;
+
+    if ( count < 0 ) {
+        PyErr_SetString(PyExc_ValueError, "count must not be negative");
+        return nullptr;
+    }
+
+    // Convert the parameters once rather than once per component
+    std::vector<std::pair<std::string, std::string>> param_list;
+    if ( !getParamList(params, param_list) ) return nullptr;
+
+    char*       prefix = gModel->addNamePrefix(name_prefix);
+    std::string name(prefix);
+    free(prefix);
+    const size_t prefix_len = name.size();
+
+    ConfigGraph*  graph    = gModel->getGraph();
+    ComponentId_t first_id = UNSET_COMPONENT_ID;
+    for ( Py_ssize_t i = 0; i < count; ++i ) {
+        name.resize(prefix_len);
+        name += std::to_string(i);
+
+        ComponentId_t id = gModel->addComponent(name.c_str(), type);
+        if ( 0 == i ) first_id = id;
+
+        ConfigComponent* cc = graph->findComponent(id);
+        for ( auto& param : param_list ) {
+            cc->addParameter(param.first, param.second, true);
+        }
+        if ( nullptr != shared_set ) cc->addSharedParamSet(shared_set);
+    }
+
+    if ( 0 == count ) Py_RETURN_NONE;
+    return PyLong_FromUnsignedLongLong(first_id);
+}
+
+static PyObject*
+connectComponents(PyObject* UNUSED(self), PyObject* args)
+{
+    char*     link_prefix = nullptr;
+    PyObject* comps0      = nullptr;
+    PyObject* ports0      = nullptr;
+    PyObject* comps1      = nullptr;
+    PyObject* ports1      = nullptr;
+    PyObject* latencies   = nullptr;
+
+    PyErr_Clear();
+
+    if ( !PyArg_ParseTuple(args, "sOOOOO", &link_prefix, &comps0, &ports0, &comps1, &ports1, &latencies) ) {
+        return nullptr;
+    }
+
+    std::vector<ComponentId_t> ids0;
+    std::vector<ComponentId_t> ids1;
+    if ( !getComponentIdArray(comps0, "comp0", ids0) || !getComponentIdArray(comps1, "comp1", ids1) ) return nullptr;
+    if ( ids0.size() != ids1.size() ) {
+        PyErr_Format(PyExc_ValueError, "comp0 has %zu entries but comp1 has %zu", ids0.size(), ids1.size());
+        return nullptr;
+    }
+
+    const size_t             count = ids0.size();
+    std::vector<std::string> port0_list;
+    std::vector<std::string> port1_list;
+    std::vector<std::string> latency_list;
+    if ( !getStringArray(ports0, "port0", count, port0_list) || !getStringArray(ports1, "port1", count, port1_list) ||
+         !getStringArray(latencies, "latency", count, latency_list) ) {
+        return nullptr;
+    }
+
+    char*       prefix = gModel->addNamePrefix(link_prefix);
+    std::string name(prefix);
+    free(prefix);
+    const size_t prefix_len = name.size();
+
+    // Single values are used for every link
+    auto select = [](const std::vector<std::string>& list, size_t i) -> const char* {
+        return list.size() == 1 ? list[0].c_str() : list[i].c_str();
+    };
+
+    for ( size_t i = 0; i < count; ++i ) {
+        name.resize(prefix_len);
+        name += std::to_string(i);
+
+        const char* latency = select(latency_list, i);
+        LinkId_t    link_id = gModel->createLink(name.c_str(), latency);
+        gModel->addLink(ids0[i], link_id, select(port0_list, i), latency);
+        gModel->addLink(ids1[i], link_id, select(port1_list, i), latency);
+    }
+
+    return PyLong_FromSize_t(count);
+}
+
+static PyObject*
+generateGraph(PyObject* UNUSED(self), PyObject* args)
+{
+    char*     generator   = nullptr;
+    PyObject* gen_params  = nullptr;
+    PyObject* components  = nullptr;
+    char*     name_prefix = nullptr;
+
+    PyErr_Clear();
+
+    if ( !PyArg_ParseTuple(args, "sO!O!|s", &generator, &PyDict_Type, &gen_params, &PyDict_Type, &components,
+             &name_prefix) ) {
+        return nullptr;
+    }
+
+    Params                                           params;
+    std::vector<std::pair<std::string, std::string>> param_list;
+    if ( !getParamList(gen_params, param_list) ) return nullptr;
+    for ( auto& param : param_list ) {
+        params.insert(param.first, param.second);
+    }
+
+    // Each role maps to either a component type or a tuple of
+    // (type, [params, [shared_param_set]])
+    std::map<std::string, GraphGenerator::ComponentSpec> specs;
+    PyObject*                                            key;
+    PyObject*                                            val;
+    Py_ssize_t                                           pos = 0;
+    while ( PyDict_Next(components, &pos, &key, &val) ) {
+        // The UTF-8 conversions return nullptr with an exception set if
+        // the string can't be encoded, e.g. for lone surrogates
+        PyObject* kstr = PyObject_Str(key);
+        if ( nullptr == kstr ) return nullptr;
+        const char* role = SST_ConvertToCppString(kstr);
+        if ( nullptr == role ) {
+            Py_DECREF(kstr);
+            return nullptr;
+        }
+        GraphGenerator::ComponentSpec& spec = specs[role];
+        Py_DECREF(kstr);
+
+        if ( PyUnicode_Check(val) ) {
+            const char* type = SST_ConvertToCppString(val);
+            if ( nullptr == type ) return nullptr;
+            spec.type = type;
+            continue;
+        }
+        if ( !PyTuple_Check(val) || PyTuple_Size(val) < 1 || PyTuple_Size(val) > 3 ||
+             !PyUnicode_Check(PyTuple_GetItem(val, 0)) ) {
+            PyErr_SetString(PyExc_TypeError,
+                "components values must be a component type or a tuple of (type, [params, [shared_param_set]])");
+            return nullptr;
+        }
+        const char* type = SST_ConvertToCppString(PyTuple_GetItem(val, 0));
+        if ( nullptr == type ) return nullptr;
+        spec.type = type;
+        if ( PyTuple_Size(val) > 1 && !getParamList(PyTuple_GetItem(val, 1), spec.params) ) return nullptr;
+        if ( PyTuple_Size(val) > 2 ) {
+            PyObject* set = PyObject_Str(PyTuple_GetItem(val, 2));
+            if ( nullptr == set ) return nullptr;
+            const char* set_name = SST_ConvertToCppString(set);
+            if ( nullptr != set_name ) spec.shared_param_set = set_name;
+            Py_DECREF(set);
+            if ( nullptr == set_name ) return nullptr;
+        }
+    }
+
+    std::unique_ptr<GraphGenerator> gen;
+    try {
+        gen.reset(Factory::getFactory()->CreateWithParams<GraphGenerator>(generator, params, params));
+    }
+    catch ( const std::exception& e ) {
+        PyErr_Format(PyExc_ValueError, "Unable to create graph generator %s: %s", generator, e.what());
+        return nullptr;
+    }
+
+    const std::vector<std::string>& roles = gen->getRoles();
+    for ( auto& spec : specs ) {
+        if ( std::find(roles.begin(), roles.end(), spec.first) == roles.end() ) {
+            std::string valid;
+            for ( auto& role : roles ) {
+                valid += (valid.empty() ? "" : ", ") + role;
+            }
+            PyErr_Format(PyExc_ValueError, "Graph generator %s has no role %s (valid roles: %s)", generator,
+                spec.first.c_str(), valid.c_str());
+            return nullptr;
+        }
+    }
+
+    int ranks   = 1;
+    int my_rank = 0;
+#ifdef SST_CONFIG_HAVE_MPI
+    MPI_Comm_size(MPI_COMM_WORLD, &ranks);
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+#endif
+    Config*  cfg        = gModel->getConfig();
+    RankInfo world_size(ranks, cfg->num_threads());
+
+    char*       prefix = gModel->addNamePrefix(name_prefix ? name_prefix : "");
+    std::string full_prefix(prefix);
+    free(prefix);
+
+    uint64_t count = gen->generate(
+        gModel->getGraph(), full_prefix, specs, world_size, RankInfo(my_rank, 0), cfg->parallel_load());
+    return PyLong_FromUnsignedLongLong(count);
+}
+
 static PyObject*
 buildOverheadMeasureTest(PyObject* UNUSED(self), PyObject* args)
 {
@@ -1034,6 +1440,9 @@ static PyMethodDef sstModuleMethods[] = {
     { "addGlobalParams", addSharedParams, METH_VARARGS, "Add parameters in dictionary to the specified shared set." },
     { "addSharedParam", addSharedParam, METH_VARARGS, "Add a parameter to the specified shared set." },
     { "addSharedParams", addSharedParams, METH_VARARGS, "Add parameters in dictionary to the specified shared set." },
+    { "enableSharedParamsCache", enableSharedParamsCache, METH_VARARGS,
+        "Caches the converted values of the specified shared set, so each value is only converted once for all the "
+        "components subscribed to it (form: enableSharedParamsCache(set, enable=True))." },
     { "getElapsedExecutionTime", getElapsedExecutionTime, METH_NOARGS,
         "Gets the real elapsed time since simulation start, returned as a UnitAlgebra.  Not precise enough for "
         "getting fine timings.  For that, use the built-in time module." },
@@ -1042,6 +1451,20 @@ static PyMethodDef sstModuleMethods[] = {
     { "setCallPythonFinalize", setCallPythonFinalize, METH_O,
         "Sets whether or not Py_Finalize will be called after SST model generation is done.  Py_Finalize will be "
         "called by default if this function is not called." },
+    { "createComponents", createComponents, METH_VARARGS,
+        "Creates count components of the same type named name_prefix0 to name_prefixN-1 (form: "
+        "createComponents(name_prefix, type, count, [params, [shared_param_set]])).  Returns the id of the first "
+        "component; the ids are consecutive." },
+    { "connectComponents", connectComponents, METH_VARARGS,
+        "Creates and connects links named link_prefix0 to link_prefixN-1 (form: connectComponents(link_prefix, "
+        "comp0, port0, comp1, port1, latency)).  comp0 and comp1 are integer arrays or sequences of component ids "
+        "or Component/SubComponent objects.  port0, port1 and latency are single values or sequences.  Returns the "
+        "number of links created." },
+    { "generateGraph", generateGraph, METH_VARARGS,
+        "Builds a topology with a native graph generator (form: generateGraph(generator, params, components, "
+        "[name_prefix])).  components maps each role of the generator to a component type or a tuple of (type, "
+        "[params, [shared_param_set]]); roles that are left out are not built.  With parallel load, only this "
+        "rank's part of the topology is built.  Returns the number of components built on this rank." },
     { "buildOverheadMeasureTest", buildOverheadMeasureTest, METH_VARARGS,
         "Build the OverheadMeasure test with the specified number of components and links between components." },
     { nullptr, nullptr, 0, nullptr }
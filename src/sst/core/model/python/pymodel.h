@@ -132,6 +132,8 @@ public: /* Public, but private.  Called only from Python functions */
         insertGlobalParameter(set, key, value, overwrite);
     }
 
+    void enableSharedParamsCache(const char* set, bool enable) { enableSharedParamSetCache(set, enable); }
+
     UnitAlgebra getElapsedExecutionTime() const;
     UnitAlgebra getLocalMemoryUsage() const;
 
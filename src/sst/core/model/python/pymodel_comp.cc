@@ -385,14 +385,14 @@ compSetCoords(PyObject* self, PyObject* args)
         if ( PyArg_ParseTuple(args, "O!", &PyList_Type, &list) && PyList_Size(list) > 0 ) {
             coords.clear();
             for ( Py_ssize_t i = 0; i < PyList_Size(list); i++ ) {
-                coords.push_back(PyFloat_AsDouble(PyList_GetItem(list, 0)));
+                coords.push_back(PyFloat_AsDouble(PyList_GetItem(list, i)));
                 if ( PyErr_Occurred() ) goto error;
             }
         }
         else if ( PyArg_ParseTuple(args, "O!", &PyTuple_Type, &list) && PyTuple_Size(list) > 0 ) {
             coords.clear();
             for ( Py_ssize_t i = 0; i < PyTuple_Size(list); i++ ) {
-                coords.push_back(PyFloat_AsDouble(PyTuple_GetItem(list, 0)));
+                coords.push_back(PyFloat_AsDouble(PyTuple_GetItem(list, i)));
                 if ( PyErr_Occurred() ) goto error;
             }
         }
@@ -15,6 +15,7 @@
 
 #include "sst/core/model/restart/sstcptmodel.h"
 
+#include "sst/core/checkpointAction.h"
 #include "sst/core/simulation.h"
 
 #include <cstdint>
@@ -42,21 +43,16 @@ SSTCPTModelDefinition::createConfigGraph()
     ser.enable_pointer_tracking();
     std::vector<char> restart_data_buffer;
 
-    std::ifstream fs(cfg.configFile());
-    if ( !fs.is_open() ) {
-        if ( fs.bad() ) {
-            fprintf(stderr, "Unable to open checkpoint file [%s]: badbit set\n", cfg.configFile().c_str());
-            SST_Exit(-1);
-        }
-        if ( fs.fail() ) {
-            fprintf(stderr, "Unable to open checkpoint file [%s]: %s\n", cfg.configFile().c_str(), strerror(errno));
-            SST_Exit(-1);
-        }
-        fprintf(stderr, "Unable to open checkpoint file [%s]: unknown error\n", cfg.configFile().c_str());
+    // The registry is read through a checkpoint file stream so that
+    // a checkpoint kept in memory can be restarted
+    auto          registry_file = Checkpointing::openCheckpointFile(manifest_);
+    std::istream& fs            = *registry_file;
+    if ( !fs ) {
+        fprintf(stderr, "Unable to open checkpoint file [%s]: %s\n", manifest_.c_str(), strerror(errno));
         SST_Exit(-1);
     }
 
-    std::string checkpoint_directory = cfg.configFile().substr(0, cfg.configFile().find_last_of('/'));
+    std::string checkpoint_directory = manifest_.substr(0, manifest_.find_last_of('/'));
 
     std::string line;
 
@@ -65,6 +61,8 @@ SSTCPTModelDefinition::createConfigGraph()
     std::string globals_search_string("** (globals): ");
     std::string configgraph_filename;
     std::string configgraph_search_string("** (configgraph): ");
+    std::string index_filename;
+    std::string index_search_string("** (component index): ");
     std::string registry_search_string("** (start component registry):");
 
     // Look for the line that has the global data file
@@ -85,25 +83,22 @@ SSTCPTModelDefinition::createConfigGraph()
             if ( pos == 0 )
                 configgraph_filename = checkpoint_directory + "/" + line.substr(configgraph_search_string.length());
 
+            // Check for component index file
+            pos = line.find(index_search_string);
+            if ( pos == 0 ) index_filename = checkpoint_directory + "/" + line.substr(index_search_string.length());
+
             // Check for end
             pos = line.find(registry_search_string);
             if ( pos == 0 ) break;
         }
     }
 
-    // Need to open the globals file
-    std::ifstream fs_globals(globals_filename);
-    if ( !fs_globals.is_open() ) {
-        if ( fs_globals.bad() ) {
-            fprintf(stderr, "Unable to open checkpoint globals file [%s]: badbit set\n", globals_filename.c_str());
-            SST_Exit(-1);
-        }
-        if ( fs_globals.fail() ) {
-            fprintf(
-                stderr, "Unable to open checkpoint globals file [%s]: %s\n", globals_filename.c_str(), strerror(errno));
-            SST_Exit(-1);
-        }
-        fprintf(stderr, "Unable to open checkpoint globals file [%s]: unknown error\n", globals_filename.c_str());
+    // The globals file may be compressed, so read it through a
+    // checkpoint file stream
+    auto          globals_file = Checkpointing::openCheckpointFile(globals_filename);
+    std::istream& fs_globals   = *globals_file;
+    if ( !fs_globals ) {
+        fprintf(stderr, "Unable to open checkpoint globals file [%s]: %s\n", globals_filename.c_str(), strerror(errno));
         SST_Exit(-1);
     }
 
@@ -294,7 +289,7 @@ SSTCPTModelDefinition::createConfigGraph()
     // Done with restart_data_buffer
     restart_data_buffer.clear();
 
-    fs_globals.close();
+    globals_file.reset();
     setOptionFromModel("load-checkpoint", "");
 
     // If we are repartitioning for the restart, need to read in the graph
@@ -333,10 +328,16 @@ SSTCPTModelDefinition::createConfigGraph()
         fs_cg.close();
 
         // Need to annotate the components in the graph with the file and offset to find the serialized blob for that
-        // component
+        // component.  Use the component index if the checkpoint has one, otherwise parse the registry.
+        Checkpointing::ComponentIndex index;
+        if ( !index_filename.empty() && Checkpointing::readComponentIndex(index_filename, index) ) {
+            for ( auto& entry : index.components ) {
+                graph->annotateCompRestartLocation(entry.id, index.files[entry.file], entry.offset);
+            }
+        }
 
         std::string current_filename;
-        while ( std::getline(fs, line) ) {
+        while ( index.components.empty() && std::getline(fs, line) ) {
             if ( line.empty() ) continue;
 
             size_t pos = line.find("**");
@@ -344,6 +345,11 @@ SSTCPTModelDefinition::createConfigGraph()
                 // This is a new filename.  Search for "): " to find the start of the filename
                 pos = line.rfind(':');
                 if ( pos != std::string::npos ) current_filename = line.substr(pos + 2);
+                // Partitions in a shared file also give the offset of
+                // their data, but component offsets are already
+                // offsets in the file
+                pos = current_filename.find(" @ ");
+                if ( pos != std::string::npos ) current_filename = current_filename.substr(0, pos);
             }
             else {
                 // parse "comp_id : offset (…)"
@@ -365,7 +371,7 @@ SSTCPTModelDefinition::createConfigGraph()
         }
     }
 
-    fs.close();
+    registry_file.reset();
 
     // Put in the path to the original config graph bin file
     graph->cpt_orig_configgraph = configgraph_filename;
@@ -16,6 +16,8 @@
 #include "sst/core/config.h"
 #include "sst/core/factory.h"
 
+#include <mutex>
+
 namespace SST {
 
 SST_ELI_DEFINE_INFO_EXTERN(SSTModelDescription)
@@ -44,6 +46,31 @@ SSTModelDescription::insertGlobalParameter(
     Params::insert_shared(set, key, value, overwrite);
 }
 
+void
+SSTModelDescription::enableSharedParamSetCache(const std::string& set, bool enable)
+{
+    Params::enableSharedValueCache(set, enable);
+}
+
+bool
+SSTModelDescription::restoreParamKeys(const std::vector<std::string>& keys)
+{
+    std::scoped_lock lock(Params::keyLock);
+    // Keys that already exist must have the same ids as in the stored
+    // model
+    if ( Params::keyMapReverse.size() > keys.size() ) return false;
+    for ( size_t i = 0; i < Params::keyMapReverse.size(); ++i ) {
+        if ( Params::keyMapReverse[i] != keys[i] ) return false;
+    }
+
+    for ( size_t i = Params::keyMapReverse.size(); i < keys.size(); ++i ) {
+        Params::keyMap[keys[i]] = i;
+        Params::keyMapReverse.push_back(keys[i]);
+    }
+    Params::nextKeyID = keys.size();
+    return true;
+}
+
 
 bool
 SSTModelDescription::isElementParallelCapable(const std::string& type)
@@ -85,6 +85,29 @@ protected:
     void insertGlobalParameter(
         const std::string& set, const Params::key_type& key, const Params::key_type& value, bool overwrite = true);
 
+    /**
+     * Allows ModelDefinition to turn on caching of converted values
+     * for a shared param set, so each value is only converted once
+     * for all the components subscribed to the set.
+     *
+     * @param set Name of the shared param set
+     *
+     * @param enable Turn caching on if true, off if false
+     */
+    void enableSharedParamSetCache(const std::string& set, bool enable = true);
+
+    /**
+     * Restores the parameter key ids of a model that was stored along
+     * with the key ids used in its Params objects.  Key i in keys is
+     * given id i.
+     *
+     * @param keys Names of the keys, indexed by key id
+     *
+     * @return true if successful, false if keys already in use have
+     * different ids
+     */
+    static bool restoreParamKeys(const std::vector<std::string>& keys);
+
 
 private:
     Config* config;
@@ -24,15 +24,11 @@ serialize(dataType& data)
 {
     SST::Core::Serialization::serializer ser;
 
-    ser.start_sizing();
+    ser.start_packing();
     SST_SER(data);
 
-    size_t size = ser.size();
-
-    std::vector<char> buffer(size);
-
-    ser.start_packing(buffer.data(), size);
-    SST_SER(data);
+    std::vector<char> buffer(ser.size());
+    ser.copy_packed(buffer.data());
 
     return buffer;
 }
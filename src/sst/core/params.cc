@@ -31,16 +31,26 @@ namespace SST {
 const std::string&
 Params::getString(const std::string& name, bool& found) const
 {
-    static std::string empty;
-    for ( auto map : data ) {
-        auto value = map->find(getKey(name));
-        if ( value != map->end() ) {
-            found = true;
-            return value->second;
+    static std::string           empty;
+    const ParamsMap*             map;
+    const ParamsMap::value_type* entry = getEntry(name, map);
+    found                              = (entry != nullptr);
+    return found ? entry->second : empty;
+}
+
+const ParamsMap::value_type*
+Params::getEntry(const std::string& name, const ParamsMap*& map) const
+{
+    uint32_t key;
+    if ( !lookupKey(name, key) ) return nullptr;
+    for ( auto m : data ) {
+        auto value = m->find(key);
+        if ( value != m->end() ) {
+            map = m;
+            return &(*value);
         }
     }
-    found = false;
-    return empty;
+    return nullptr;
 }
 
 size_t
@@ -93,7 +103,8 @@ Params::clear()
 size_t
 Params::count(const key_type& k) const
 {
-    int key = getKey(k);
+    uint32_t key;
+    if ( !lookupKey(k, key) ) return 0;
     for ( auto map : data ) {
         size_t count = map->count(key);
         if ( count > 0 ) return count;
@@ -232,8 +243,10 @@ Params::get_scoped_params(const std::string& scope) const
 bool
 Params::contains(const key_type& k) const
 {
+    uint32_t key;
+    if ( !lookupKey(k, key) ) return false;
     for ( auto map : data ) {
-        if ( map->find(getKey(k)) != map->end() ) return true;
+        if ( map->find(key) != map->end() ) return true;
     }
     return false;
 }
@@ -364,11 +377,46 @@ Params::getKey(const std::string& str)
         keyMapReverse.push_back(str);
         // ID 0 is reserved for holding metadata
         assert(keyMapReverse.size() == nextKeyID);
+        if ( keyTableFrozen.load(std::memory_order_relaxed) ) {
+            keysAddedAfterFreeze.store(true, std::memory_order_release);
+        }
         return id;
     }
     return i->second;
 }
 
+bool
+Params::lookupKey(const std::string& str, uint32_t& id)
+{
+    if ( keyTableFrozen.load(std::memory_order_acquire) ) {
+        auto i = frozenKeyMap.find(str);
+        if ( i != frozenKeyMap.end() ) {
+            id = i->second;
+            return true;
+        }
+        // Only need to check the live table if it has grown since
+        // the snapshot was taken
+        if ( !keysAddedAfterFreeze.load(std::memory_order_acquire) ) return false;
+    }
+
+    std::scoped_lock lock(keyLock);
+    auto             i = keyMap.find(str);
+    if ( i == keyMap.end() ) return false;
+    id = i->second;
+    return true;
+}
+
+void
+Params::freezeKeyTable()
+{
+    std::scoped_lock lock(keyLock);
+    if ( keyTableFrozen.load(std::memory_order_relaxed) ) return;
+    frozenKeyMap.reserve(keyMap.size());
+    frozenKeyMap.insert(keyMap.begin(), keyMap.end());
+    keysAddedAfterFreeze.store(false, std::memory_order_relaxed);
+    keyTableFrozen.store(true, std::memory_order_release);
+}
+
 void
 Params::addSharedParamSet(const std::string& set)
 {
@@ -395,6 +443,16 @@ Params::insert_shared(const std::string& shared_key, const std::string& key, con
     }
 }
 
+void
+Params::enableSharedValueCache(const std::string& set, bool enable)
+{
+    std::scoped_lock lock(sharedLock);
+    if ( shared_params.count(set) == 0 ) {
+        shared_params[set][0] = set;
+    }
+    shared_params[set].enableValueCache(enable);
+}
+
 void
 Params::getDelimitedTokens(const std::string& value, char delim, std::vector<std::string>& tokens) const
 {
@@ -608,6 +666,10 @@ Core::ThreadSafe::Spinlock      Params::sharedLock;
 // ID 0 is reserved for holding metadata
 bool                            Params::g_verify_enabled = false;
 
-std::map<std::string, std::map<uint32_t, std::string>> Params::shared_params;
+std::unordered_map<std::string, uint32_t> Params::frozenKeyMap;
+std::atomic<bool>                         Params::keyTableFrozen(false);
+std::atomic<bool>                         Params::keysAddedAfterFreeze(false);
+
+std::map<std::string, ParamsMap> Params::shared_params;
 
 } // namespace SST
@@ -13,10 +13,12 @@
 #define SST_CORE_PARAM_H
 
 #include "sst/core/from_string.h"
+#include "sst/core/paramsMap.h"
 #include "sst/core/serialization/serializable.h"
 #include "sst/core/serialization/serializer.h"
 #include "sst/core/threadsafe.h"
 
+#include <atomic>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
@@ -32,6 +34,7 @@
 #include <stdlib.h>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -154,13 +157,14 @@ NO_VARIABLE:
     inline T find_impl(const std::string& k, T default_value, bool& found) const
     {
         verifyKey(k);
-        // const_iterator i = data.find(getKey(k));
-        const std::string& value = getString(k, found);
+        const ParamsMap*             map;
+        const ParamsMap::value_type* entry = getEntry(k, map);
+        found                              = (entry != nullptr);
         if ( !found ) {
             return default_value;
         }
         else {
-            return convert_value<T>(k, value);
+            return convert_cached<T>(k, *map, *entry);
         }
     }
 
@@ -178,7 +182,9 @@ NO_VARIABLE:
     inline T find_impl(const std::string& k, const std::string& default_value, bool& found) const
     {
         verifyKey(k);
-        const std::string& value = getString(k, found);
+        const ParamsMap*             map;
+        const ParamsMap::value_type* entry = getEntry(k, map);
+        found                              = (entry != nullptr);
         if ( !found ) {
             try {
                 return SST::Core::from_string<T>(default_value);
@@ -191,23 +197,45 @@ NO_VARIABLE:
             }
         }
         else {
-            found = true;
-            try {
-                return SST::Core::from_string<T>(value);
-            }
-            catch ( const std::invalid_argument& e ) {
-                std::string msg = "Params::find(): No conversion for value: key = " + k + ", value =  " + value +
-                                  ".  Original error: " + e.what();
-                std::invalid_argument t(msg);
-                throw t;
+            return convert_cached<T>(k, *map, *entry);
+        }
+    }
+
+    /** Private utility function to convert a value found in map to
+     * type T.  If map has its value cache enabled, the converted value
+     * is taken from the cache if present, and otherwise added to it.
+     * @param k - Parameter name
+     * @param map - Map containing the value
+     * @param entry - Key ID and value
+     * @throw std::invalid_argument If the value can't be converted to type T
+     */
+    template <class T>
+    inline T convert_cached(const std::string& k, const ParamsMap& map, const ParamsMap::value_type& entry) const
+    {
+        if constexpr ( std::is_copy_constructible_v<T> ) {
+            if ( map.isValueCacheEnabled() ) {
+                if ( auto cached = map.getCachedValue<T>(entry.first) ) return *cached;
+                T value = convert_value<T>(k, entry.second);
+                map.setCachedValue<T>(entry.first, value);
+                return value;
             }
         }
+        return convert_value<T>(k, entry.second);
     }
 
-    using const_iterator = std::map<uint32_t, std::string>::const_iterator; /*!< Const Iterator type */
+    using const_iterator = ParamsMap::const_iterator; /*!< Const Iterator type */
 
     const std::string& getString(const std::string& name, bool& found) const;
 
+    /**
+     * Finds the entry for a key, checking the local params and then
+     * the shared sets in order.
+     * @param name - Parameter name
+     * @param map - Set to the map containing the entry
+     * @return Pointer to the entry, or nullptr if not found
+     */
+    const ParamsMap::value_type* getEntry(const std::string& name, const ParamsMap*& map) const;
+
     /**
        Private function to clean up a token. It will remove leading
        and trailing whitespace, leading and trailing quotes (single or
@@ -257,6 +285,16 @@ public:
         return old;
     }
 
+    /**
+     * Enable or disable caching of converted values for the local
+     * params of this object.  With caching enabled, repeated calls to
+     * find<T>() for the same key and type only convert the value
+     * once.  Copies of the object get their own cache.  Shared param
+     * sets have their own setting (see
+     * SSTModelDescription::enableSharedParamSetCache()).
+     */
+    void enableValueCache(bool enable = true) { my_data.enableValueCache(enable); }
+
     /**
      * Enable, on a global scale, parameter verification.  Used
      * after construction of the config graph so that warnings are
@@ -901,6 +939,19 @@ private:
     static void insert_shared(
         const std::string& set, const key_type& key, const key_type& value, bool overwrite = true);
 
+    /**
+     * Enables or disables caching of converted values for the
+     * specified shared set.  With caching enabled, find<T>() converts
+     * each value in the set to a given type only once, no matter how
+     * many Params objects subscribe to the set.  The set is created if
+     * it does not yet exist.
+     *
+     * @param set shared set to enable caching for
+     *
+     * @param enable true to enable caching, false to disable
+     */
+    static void enableSharedValueCache(const std::string& set, bool enable = true);
+
     /**
      * Get a named shared parameter set.
      *
@@ -949,14 +1000,38 @@ private:
 
 
     // Private data
-    std::map<uint32_t, std::string>               my_data;
-    std::vector<std::map<uint32_t, std::string>*> data;
-    std::vector<KeySet_t>                         allowedKeys;
-    bool                                          verify_enabled;
-    static bool                                   g_verify_enabled;
+    ParamsMap               my_data;
+    std::vector<ParamsMap*> data;
+    std::vector<KeySet_t>   allowedKeys;
+    bool                    verify_enabled;
+    static bool             g_verify_enabled;
 
     static uint32_t getKey(const std::string& str);
 
+    /**
+     * Looks up the ID for a key without adding it to the key table.
+     * Used by the read paths, since a key that is not in the table
+     * cannot be in any Params object.  Once the key table has been
+     * frozen, keys that existed at that time are found without taking
+     * keyLock.
+     *
+     * @param str  Key to look up
+     * @param id   Set to the ID of the key if found
+     * @return     True if the key is in the key table
+     */
+    static bool lookupKey(const std::string& str, uint32_t& id);
+
+public:
+    /**
+     * Takes an immutable snapshot of the key table so that Params
+     * lookups no longer need to take the global key lock.  Called
+     * once graph construction is complete and before the simulation
+     * threads start building components.  Keys can still be added
+     * afterwards; lookups of those keys fall back to the locked table.
+     */
+    static void freezeKeyTable();
+
+private:
     /**
      * Given a Parameter Key ID, return the Name of the matching parameter
      * @param id  Key ID to look up
@@ -975,7 +1050,11 @@ private:
     static SST::Core::ThreadSafe::Spinlock sharedLock;
     static uint32_t                        nextKeyID;
 
-    static std::map<std::string, std::map<uint32_t, std::string>> shared_params;
+    static std::unordered_map<std::string, uint32_t> frozenKeyMap;
+    static std::atomic<bool>                         keyTableFrozen;
+    static std::atomic<bool>                         keysAddedAfterFreeze;
+
+    static std::map<std::string, ParamsMap> shared_params;
 };
 
 #if 0
@@ -0,0 +1,238 @@
+// -*- c++ -*-
+
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_PARAMSMAP_H
+#define SST_CORE_PARAMSMAP_H
+
+#include "sst/core/serialization/serialize.h"
+#include "sst/core/threadsafe.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace SST {
+
+/**
+   Storage for the key/value pairs of a Params object or shared param
+   set.  Key IDs and values are stored in a vector sorted by key ID,
+   so lookups are a binary search over contiguous memory instead of a
+   walk through the nodes of a tree, and copying a set of params is a
+   single allocation (plus the allocations for long values).
+
+   Provides the subset of the std::map interface used by Params.
+   Inserts are O(n), which is fine for the handful of params an
+   element typically has.
+
+   Optionally caches the result of converting a value to a given type,
+   so Params::find<T>() only parses a value once no matter how many
+   components subscribe to a shared set.  The cache is emptied by any
+   insert; values must not be modified through iterators while the
+   cache is enabled.  The enabled flag is atomic and the cache, once
+   allocated, lives as long as the map, so a shared set can have
+   caching turned on or off while other threads are reading it (e.g.
+   after Params::freezeKeyTable() while components are being built).
+
+   NOTE: As with any vector, references and iterators are invalidated
+   by inserts.
+ */
+class ParamsMap
+{
+public:
+    using key_type       = uint32_t;
+    using mapped_type    = std::string;
+    using value_type     = std::pair<key_type, mapped_type>;
+    using iterator       = std::vector<value_type>::iterator;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    ParamsMap() = default;
+
+    /** Copies the data.  If other caches values, the copy gets its own, empty cache. */
+    ParamsMap(const ParamsMap& other) :
+        data_(other.data_)
+    {
+        enableValueCache(other.isValueCacheEnabled());
+    }
+
+    ParamsMap(ParamsMap&& other) :
+        data_(std::move(other.data_)),
+        cache_(std::move(other.cache_)),
+        cache_enabled_(other.cache_enabled_.load(std::memory_order_relaxed))
+    {
+        other.cache_enabled_.store(false, std::memory_order_relaxed);
+    }
+
+    ParamsMap& operator=(const ParamsMap& other)
+    {
+        data_ = other.data_;
+        invalidateCache();
+        enableValueCache(other.isValueCacheEnabled());
+        return *this;
+    }
+
+    ParamsMap& operator=(ParamsMap&& other)
+    {
+        data_  = std::move(other.data_);
+        cache_ = std::move(other.cache_);
+        cache_enabled_.store(other.cache_enabled_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        other.cache_enabled_.store(false, std::memory_order_relaxed);
+        return *this;
+    }
+
+    iterator       begin() { return data_.begin(); }
+    iterator       end() { return data_.end(); }
+    const_iterator begin() const { return data_.begin(); }
+    const_iterator end() const { return data_.end(); }
+
+    size_t size() const { return data_.size(); }
+    size_t capacity() const { return data_.capacity(); }
+    bool   empty() const { return data_.empty(); }
+    void   clear()
+    {
+        data_.clear();
+        invalidateCache();
+    }
+
+    iterator find(key_type key)
+    {
+        auto it = lower_bound(key);
+        return (it != data_.end() && it->first == key) ? it : data_.end();
+    }
+
+    const_iterator find(key_type key) const
+    {
+        auto it = lower_bound(key);
+        return (it != data_.end() && it->first == key) ? it : data_.end();
+    }
+
+    size_t count(key_type key) const { return find(key) == end() ? 0 : 1; }
+
+    /**
+       Inserts the key/value pair if the key is not already present.
+       Same semantics as std::map::insert().
+     */
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        auto it = lower_bound(value.first);
+        if ( it != data_.end() && it->first == value.first ) return std::make_pair(it, false);
+        invalidateCache();
+        return std::make_pair(data_.insert(it, value), true);
+    }
+
+    /** Inserts all pairs in the range whose keys are not already present */
+    template <class InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for ( ; first != last; ++first ) {
+            insert(*first);
+        }
+    }
+
+    mapped_type& operator[](key_type key)
+    {
+        // The caller may write through the returned reference
+        invalidateCache();
+        auto it = lower_bound(key);
+        if ( it == data_.end() || it->first != key ) it = data_.insert(it, value_type(key, mapped_type()));
+        return it->second;
+    }
+
+    /**
+       Turns caching of converted values on or off.  Any values already
+       cached are dropped.  The first call that enables caching must
+       not race with readers, since it allocates the cache; after
+       that, the cache can be turned on and off concurrently with
+       lookups.
+     */
+    void enableValueCache(bool enable)
+    {
+        if ( enable && !cache_ ) cache_.reset(new ValueCache());
+        invalidateCache();
+        // Release so that a reader that sees the flag also sees the cache
+        cache_enabled_.store(enable, std::memory_order_release);
+    }
+
+    bool isValueCacheEnabled() const { return cache_enabled_.load(std::memory_order_acquire); }
+
+    /**
+       Returns the cached value of key converted to type T, or nullptr
+       if it has not been cached.  Must only be called when the cache
+       is enabled.
+     */
+    template <class T>
+    std::shared_ptr<const T> getCachedValue(key_type key) const
+    {
+        std::scoped_lock lock(cache_->lock);
+        auto             it = cache_->values.find(std::make_pair(key, std::type_index(typeid(T))));
+        if ( it == cache_->values.end() ) return nullptr;
+        return std::static_pointer_cast<const T>(it->second);
+    }
+
+    /** Caches the value of key converted to type T.  Must only be called when the cache is enabled. */
+    template <class T>
+    void setCachedValue(key_type key, const T& value) const
+    {
+        std::scoped_lock lock(cache_->lock);
+        cache_->values.emplace(std::make_pair(key, std::type_index(typeid(T))), std::make_shared<const T>(value));
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser)
+    {
+        SST_SER(data_);
+        bool cached = isValueCacheEnabled();
+        SST_SER(cached);
+        if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) enableValueCache(cached);
+    }
+
+private:
+    struct ValueCache
+    {
+        SST::Core::ThreadSafe::Spinlock                                             lock;
+        std::map<std::pair<key_type, std::type_index>, std::shared_ptr<const void>> values;
+    };
+
+    std::vector<value_type>     data_;
+    std::unique_ptr<ValueCache> cache_;
+    std::atomic<bool>           cache_enabled_ = false;
+
+    void invalidateCache()
+    {
+        if ( !cache_ ) return;
+        std::scoped_lock lock(cache_->lock);
+        cache_->values.clear();
+    }
+
+    iterator lower_bound(key_type key)
+    {
+        return std::lower_bound(
+            data_.begin(), data_.end(), key, [](const value_type& a, key_type b) { return a.first < b; });
+    }
+
+    const_iterator lower_bound(key_type key) const
+    {
+        return std::lower_bound(
+            data_.begin(), data_.end(), key, [](const value_type& a, key_type b) { return a.first < b; });
+    }
+};
+
+} // namespace SST
+
+#endif // SST_CORE_PARAMSMAP_H
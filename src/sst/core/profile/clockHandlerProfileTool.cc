@@ -13,6 +13,7 @@
 
 #include "sst/core/profile/clockHandlerProfileTool.h"
 
+#include "sst/core/model/partitionWeights.h"
 #include "sst/core/output.h"
 #include "sst/core/params.h"
 #include "sst/core/sst_types.h"
@@ -128,6 +129,40 @@ ClockHandlerProfileToolTime<T>::outputData(SST::Util::DataRecord* record, RankIn
 }
 
 
+ClockHandlerProfileToolPartition::ClockHandlerProfileToolPartition(const std::string& name, Params& params) :
+    ClockHandlerProfileTool(name, params)
+{
+    // Costs are tracked per component
+    profile_level_ = Profile_Level::Component;
+}
+
+uintptr_t
+ClockHandlerProfileToolPartition::registerHandler(const AttachPointMetaData& mdata)
+{
+    return reinterpret_cast<uintptr_t>(&times_[getKeyForHandler(mdata)]);
+}
+
+void
+ClockHandlerProfileToolPartition::outputData(SST::Util::DataRecord* record, RankInfo rank)
+{
+    record->addChild(std::to_string(rank.rank) + "_" + std::to_string(rank.thread));
+    for ( auto& x : times_ ) {
+        record->addChild(x.first);
+        UnitAlgebra handler_time(std::to_string(((double)x.second) / 1000000000.0) + "s");
+        record->addData("handler_time", handler_time);
+        record->changeLevelUp();
+    }
+}
+
+void
+ClockHandlerProfileToolPartition::addPartitionWeights(PartitionWeights& weights) const
+{
+    for ( auto& x : times_ ) {
+        weights.addCost(x.first, x.second);
+    }
+}
+
+
 class ClockHandlerProfileToolTimeHighResolution : public ClockHandlerProfileToolTime<std::chrono::high_resolution_clock>
 {
 public:
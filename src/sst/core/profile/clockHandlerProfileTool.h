@@ -27,6 +27,8 @@
 
 namespace SST {
 
+class PartitionWeights;
+
 namespace Util {
 class DataRecord;
 }
@@ -130,6 +132,50 @@ private:
     std::map<std::string, clock_data_t> times_;
 };
 
+/**
+   Profile tool that measures the time spent in clock handlers for
+   each component.  The data is used to create partition weights for
+   later runs (see --output-partition-weights).
+ */
+class ClockHandlerProfileToolPartition : public ClockHandlerProfileTool
+{
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        ClockHandlerProfileToolPartition,
+        SST::Profile::ClockHandlerProfileTool,
+        "sst",
+        "profile.handler.clock.partition",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will time handlers per component for use as partition weights"
+    )
+
+    ClockHandlerProfileToolPartition(const std::string& name, Params& params);
+
+    virtual ~ClockHandlerProfileToolPartition() {}
+
+    uintptr_t registerHandler(const AttachPointMetaData& mdata) override;
+
+    void beforeHandler(uintptr_t UNUSED(key), const Cycle_t& UNUSED(cycle)) override
+    {
+        start_time_ = std::chrono::steady_clock::now();
+    }
+
+    void afterHandler(uintptr_t key, const bool& UNUSED(remove)) override
+    {
+        auto total_time = std::chrono::steady_clock::now() - start_time_;
+        *reinterpret_cast<uint64_t*>(key) += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+    }
+
+    void outputData(SST::Util::DataRecord* record, RankInfo rank) override;
+
+    /** Adds the measured handler times to weights */
+    void addPartitionWeights(PartitionWeights& weights) const;
+
+private:
+    std::chrono::steady_clock::time_point start_time_;
+    std::map<std::string, uint64_t>       times_;
+};
+
 } // namespace Profile
 } // namespace SST
 
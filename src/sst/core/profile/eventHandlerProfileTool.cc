@@ -13,6 +13,7 @@
 
 #include "sst/core/profile/eventHandlerProfileTool.h"
 
+#include "sst/core/model/partitionWeights.h"
 #include "sst/core/output.h"
 #include "sst/core/params.h"
 #include "sst/core/sst_types.h"
@@ -155,6 +156,49 @@ EventHandlerProfileToolTime<T>::outputData(SST::Util::DataRecord* record, RankIn
 }
 
 
+EventHandlerProfileToolPartition::EventHandlerProfileToolPartition(const std::string& name, Params& params) :
+    EventHandlerProfileTool(name, params)
+{
+    // Only receives can be attributed to the receiving port
+    profile_sends_    = false;
+    profile_receives_ = true;
+}
+
+uintptr_t
+EventHandlerProfileToolPartition::registerHandler(const AttachPointMetaData& mdata)
+{
+    const EventHandlerMetaData& data = dynamic_cast<const EventHandlerMetaData&>(mdata);
+    return reinterpret_cast<uintptr_t>(&data_[std::make_pair(data.comp_name, data.port_name)]);
+}
+
+uintptr_t
+EventHandlerProfileToolPartition::registerLinkAttachTool(const AttachPointMetaData& mdata)
+{
+    return registerHandler(mdata);
+}
+
+void
+EventHandlerProfileToolPartition::outputData(SST::Util::DataRecord* record, RankInfo UNUSED(rank))
+{
+    for ( auto& x : data_ ) {
+        record->addChild(x.first.first + ":" + x.first.second);
+        record->addData("recv_count", x.second.recv_count);
+        UnitAlgebra recv_time(std::to_string(((double)x.second.recv_time) / 1000000000.0) + "s");
+        record->addData("recv_time", recv_time);
+        record->changeLevelUp();
+    }
+}
+
+void
+EventHandlerProfileToolPartition::addPartitionWeights(PartitionWeights& weights) const
+{
+    for ( auto& x : data_ ) {
+        weights.addCost(x.first.first, x.second.recv_time);
+        weights.addTraffic(x.first.first, x.first.second, x.second.recv_count);
+    }
+}
+
+
 class EventHandlerProfileToolTimeHighResolution : public EventHandlerProfileToolTime<std::chrono::high_resolution_clock>
 {
 public:
@@ -24,6 +24,11 @@
 #include <cstdint>
 #include <map>
 #include <string>
+#include <utility>
+
+namespace SST {
+class PartitionWeights;
+}
 
 namespace SST::Util {
 class DataRecord;
@@ -159,6 +164,66 @@ private:
     std::map<std::string, event_data_t> times_;
 };
 
+/**
+   Profile tool that measures the time spent in event handlers for
+   each component and the number of events received on each port.
+   The data is used to create partition weights for later runs (see
+   --output-partition-weights).
+ */
+class EventHandlerProfileToolPartition : public EventHandlerProfileTool
+{
+    struct event_data_t
+    {
+        uint64_t recv_time;
+        uint64_t recv_count;
+
+        event_data_t() :
+            recv_time(0),
+            recv_count(0)
+        {}
+    };
+
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        EventHandlerProfileToolPartition,
+        SST::Profile::EventHandlerProfileTool,
+        "sst",
+        "profile.handler.event.partition",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will time handlers per component and count events per port for use as partition weights"
+    )
+
+    EventHandlerProfileToolPartition(const std::string& name, Params& params);
+
+    virtual ~EventHandlerProfileToolPartition() {}
+
+    uintptr_t registerHandler(const AttachPointMetaData& mdata) override;
+    uintptr_t registerLinkAttachTool(const AttachPointMetaData& mdata) override;
+
+    void beforeHandler(uintptr_t UNUSED(key), const Event* UNUSED(event)) override
+    {
+        start_time_ = std::chrono::steady_clock::now();
+    }
+
+    void afterHandler(uintptr_t key) override
+    {
+        auto          total_time = std::chrono::steady_clock::now() - start_time_;
+        event_data_t* entry      = reinterpret_cast<event_data_t*>(key);
+        entry->recv_time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+        entry->recv_count++;
+    }
+
+    void outputData(SST::Util::DataRecord* record, RankInfo rank) override;
+
+    /** Adds the measured handler times and port traffic to weights */
+    void addPartitionWeights(PartitionWeights& weights) const;
+
+private:
+    std::chrono::steady_clock::time_point                        start_time_;
+    // Keyed by (sub)component name and port name
+    std::map<std::pair<std::string, std::string>, event_data_t> data_;
+};
+
 } // namespace SST::Profile
 
 #endif // SST_CORE_PROFILE_EVENTHANDLERPROFILETOOL_H
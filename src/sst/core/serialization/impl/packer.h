@@ -19,11 +19,11 @@
 
 #include "sst/core/serialization/impl/get_array_size.h"
 #include "sst/core/serialization/impl/ser_buffer_accessor.h"
+#include "sst/core/serialization/impl/ser_pointer_set.h"
 #include "sst/core/serialization/impl/ser_shared_ptr_tracker.h"
 
 #include <cstdint>
 #include <cstring>
-#include <set>
 #include <string>
 #include <type_traits>
 
@@ -31,12 +31,23 @@ namespace SST::Core::Serialization::pvt {
 
 class ser_packer : public ser_buffer_accessor, public ser_shared_ptr_packer
 {
-    std::set<uintptr_t> pointer_set;
+    ser_pointer_set     pointer_set;
+    ser_chunked_buffer* chunks_ = nullptr;
 
 public:
     // inherit ser_buffer_accessor constructors
     using ser_buffer_accessor::ser_buffer_accessor;
 
+    // pack into a buffer that grows as needed instead of a fixed size buffer
+    explicit ser_packer(ser_chunked_buffer* chunks) :
+        ser_buffer_accessor(nullptr, 0),
+        chunks_(chunks)
+    {}
+
+    void* buf_next(size_t size) { return chunks_ ? chunks_->buf_next(size) : ser_buffer_accessor::buf_next(size); }
+
+    size_t size() const { return chunks_ ? chunks_->size() : ser_buffer_accessor::size(); }
+
     template <typename T>
     void pack(const T& t)
     {
@@ -57,7 +68,10 @@ public:
     }
 
     void pack_string(const std::string& str) { pack_buffer(str.data(), str.size()); }
-    bool check_pointer_pack(uintptr_t ptr) { return !pointer_set.insert(ptr).second; }
+    bool check_pointer_pack(uintptr_t ptr) { return pointer_set.insert(ptr); }
+
+    // pointers tracked so far, for reporting
+    const ser_pointer_set& tracked_pointers() const { return pointer_set; }
 }; // class ser_packer
 
 } // namespace SST::Core::Serialization::pvt
@@ -17,8 +17,13 @@
     "The header file sst/core/serialization/impl/ser_buffer_accessor.h should not be directly included as it is not part of the stable public API.  The file is included in sst/core/serialization/serializer.h"
 #endif
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <memory>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace SST::Core::Serialization::pvt {
 
@@ -53,6 +58,123 @@ public:
     size_t size() const { return size_; }
 };
 
+/**
+   Buffer that grows as data is packed into it, so data can be packed
+   without being sized first.  Memory is allocated in chunks which are
+   never moved, so pointers returned by buf_next() stay valid.  Each
+   request is contiguous, which may leave the end of a chunk unused.
+
+   The first chunk can be a buffer provided by the caller, so data
+   that fits in it never needs to be copied out.
+ */
+class ser_chunked_buffer
+{
+    struct chunk
+    {
+        std::unique_ptr<char[]> storage; // nullptr for a buffer provided by the caller
+        char*                   data     = nullptr;
+        size_t                  capacity = 0;
+        size_t                  used     = 0;
+    };
+
+    static constexpr size_t min_chunk_size_ = 64 * 1024;
+    static constexpr size_t max_chunk_size_ = 16 * 1024 * 1024;
+
+    std::vector<chunk> chunks_;
+    size_t             size_ = 0;
+
+    // Allocated chunk kept for reuse while packing into a caller's buffer
+    chunk spare_;
+
+    void add_chunk(size_t size)
+    {
+        if ( spare_.storage && spare_.capacity >= size ) {
+            chunks_.push_back(std::move(spare_));
+            spare_ = chunk();
+            return;
+        }
+
+        // Chunks double with the size of the data, so the number of
+        // chunks grows logarithmically
+        size_t capacity = std::max(size, std::clamp(size_, min_chunk_size_, max_chunk_size_));
+        auto   storage  = std::unique_ptr<char[]>(new char[capacity]);
+        char*  data     = storage.get();
+        chunks_.push_back({ std::move(storage), data, capacity, 0 });
+    }
+
+public:
+    ser_chunked_buffer() = default;
+
+    ser_chunked_buffer(const ser_chunked_buffer&)            = delete;
+    ser_chunked_buffer& operator=(const ser_chunked_buffer&) = delete;
+
+    // return a pointer to size contiguous bytes at the end of the data
+    void* buf_next(size_t size)
+    {
+        if ( chunks_.empty() || chunks_.back().capacity - chunks_.back().used < size ) add_chunk(size);
+        chunk& last = chunks_.back();
+        char*  buf  = last.data + last.used;
+        last.used += size;
+        size_ += size;
+        return buf;
+    }
+
+    size_t size() const { return size_; }
+
+    // whether all of the data is in the caller's buffer passed to clear()
+    bool in_place() const { return chunks_.size() == 1 && !chunks_.front().storage; }
+
+    // call f(const char* data, size_t size) on each contiguous piece of the data in order
+    template <typename F>
+    void for_each_chunk(F&& f) const
+    {
+        for ( const auto& c : chunks_ ) {
+            if ( c.used != 0 ) f(static_cast<const char*>(c.data), c.used);
+        }
+    }
+
+    // copy the data to dest, which must hold size() bytes
+    void copy_to(void* dest) const
+    {
+        char* out = static_cast<char*>(dest);
+        for_each_chunk([&out](const char* data, size_t size) {
+            memcpy(out, data, size);
+            out += size;
+        });
+    }
+
+    // discard the data.  If it needed more than one chunk, the chunks
+    // are replaced by one that can hold all of it, so packing the same
+    // amount of data again doesn't allocate.  If buffer is not
+    // nullptr, data is packed into it until its capacity bytes are
+    // used.  The buffer is not used after the next call to clear().
+    void clear(char* buffer = nullptr, size_t capacity = 0)
+    {
+        if ( !chunks_.empty() && !chunks_.front().storage ) chunks_.erase(chunks_.begin());
+        if ( chunks_.empty() && spare_.storage ) {
+            chunks_.push_back(std::move(spare_));
+            spare_ = chunk();
+        }
+        if ( chunks_.size() > 1 ) {
+            size_t chunk_size = std::max(size_, min_chunk_size_);
+            auto   storage    = std::unique_ptr<char[]>(new char[chunk_size]);
+            char*  data       = storage.get();
+            chunks_.clear();
+            chunks_.push_back({ std::move(storage), data, chunk_size, 0 });
+        }
+        if ( !chunks_.empty() ) chunks_.front().used = 0;
+        size_ = 0;
+
+        if ( buffer != nullptr ) {
+            if ( !chunks_.empty() ) {
+                spare_ = std::move(chunks_.front());
+                chunks_.clear();
+            }
+            chunks_.push_back({ nullptr, buffer, capacity, 0 });
+        }
+    }
+};
+
 } // namespace SST::Core::Serialization::pvt
 
 #endif // SST_CORE_SERIALIZATION_IMPL_SER_BUFFER_ACCESSOR_H
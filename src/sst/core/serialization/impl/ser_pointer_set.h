@@ -0,0 +1,107 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SERIALIZATION_IMPL_SER_POINTER_SET_H
+#define SST_CORE_SERIALIZATION_IMPL_SER_POINTER_SET_H
+
+#ifndef SST_INCLUDING_SERIALIZER_H
+#warning \
+    "The header file sst/core/serialization/impl/ser_pointer_set.h should not be directly included as it is not part of the stable public API.  The file is included in sst/core/serialization/serializer.h"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SST::Core::Serialization::pvt {
+
+/**
+   Set of the addresses which have been serialized, used for pointer
+   tracking when sizing and packing.
+
+   This is an open addressing hash table with linear probing, which
+   avoids the node allocation and pointer chasing of std::set when
+   millions of pointers are tracked.  The set is only used to check
+   whether an address has been seen before and is never iterated, so
+   the serialized data does not depend on the layout of the table.
+   Address 0 marks an empty slot; nullptr is never tracked.
+ */
+class ser_pointer_set
+{
+    static constexpr size_t initial_capacity_ = 64;
+
+    std::vector<uintptr_t> table_;
+    size_t                 size_  = 0;
+    int                    shift_ = 0; // 64 - log2(capacity)
+
+    // Statistics
+    size_t lookups_ = 0;
+    size_t hits_    = 0;
+    size_t probes_  = 0;
+
+    // Fibonacci hashing spreads the aligned addresses over the table by taking the high bits of the product
+    size_t slot(uintptr_t ptr) const { return (uint64_t(ptr) * UINT64_C(0x9E3779B97F4A7C15)) >> shift_; }
+
+    // Double the capacity, keeping the load factor at or below 1/2
+    void grow()
+    {
+        std::vector<uintptr_t> old_table(table_.empty() ? initial_capacity_ : 2 * table_.size());
+        table_.swap(old_table);
+        shift_ = 64;
+        for ( size_t capacity = table_.size(); capacity > 1; capacity >>= 1 )
+            --shift_;
+
+        const size_t mask = table_.size() - 1;
+        for ( uintptr_t ptr : old_table ) {
+            if ( ptr == 0 ) continue;
+            size_t i = slot(ptr);
+            while ( table_[i] != 0 )
+                i = (i + 1) & mask;
+            table_[i] = ptr;
+        }
+    }
+
+public:
+    ser_pointer_set() = default;
+
+    // Add ptr to the set, returning whether it was already in the set.  ptr must not be 0.
+    bool insert(uintptr_t ptr)
+    {
+        if ( 2 * (size_ + 1) > table_.size() ) grow();
+
+        ++lookups_;
+        const size_t mask = table_.size() - 1;
+        for ( size_t i = slot(ptr);; i = (i + 1) & mask ) {
+            ++probes_;
+            if ( table_[i] == ptr ) {
+                ++hits_;
+                return true;
+            }
+            if ( table_[i] == 0 ) {
+                table_[i] = ptr;
+                ++size_;
+                return false;
+            }
+        }
+    }
+
+    size_t size() const { return size_; }
+    size_t capacity() const { return table_.size(); }
+
+    // Number of insert() calls, how many found the pointer already in the set, and the number of slots examined
+    size_t lookups() const { return lookups_; }
+    size_t hits() const { return hits_; }
+    size_t probes() const { return probes_; }
+}; // class ser_pointer_set
+
+} // namespace SST::Core::Serialization::pvt
+
+#endif // SST_CORE_SERIALIZATION_IMPL_SER_POINTER_SET_H
@@ -55,6 +55,9 @@ public:
 
     // Get the tag associated with a shared pointer's owner, and whether it is new
     std::pair<size_t, bool> get_shared_ptr_owner_tag(const std::weak_ptr<const void>& ptr);
+
+    // Number of std::shared_ptr owners tracked so far
+    size_t shared_ptr_owners() const { return owner_tag - 1; }
 }; // class ser_shared_ptr_packer
 
 class ser_shared_ptr_unpacker
@@ -81,6 +81,15 @@ constexpr bool is_vector_bool_v = false;
 template <typename... Ts>
 constexpr bool is_vector_bool_v<std::vector<bool, Ts...>> = true;
 
+// Whether it is a std::vector of trivially serializable elements, whose data can be copied in bulk. Each element
+// would be serialized as a copy of its bytes, so the bulk copy produces the same data.
+template <typename>
+constexpr bool is_trivially_serializable_vector_v = false;
+
+template <typename T, typename ALLOC>
+constexpr bool is_trivially_serializable_vector_v<std::vector<T, ALLOC>> =
+    is_trivially_serializable_v<T> && !std::is_same_v<T, bool>;
+
 // Whether it is a simple map (not a multimap and has integral, floating-point, enum, or convertible to string keys)
 template <typename>
 constexpr bool is_simple_map_v = false;
@@ -144,6 +153,20 @@ class serialize_impl<OBJ, std::enable_if_t<is_insertable_v<OBJ>>>
         const ser_opt_t UNUSED(opts) =
             SerOption::is_set(options, SerOption::as_ptr_elem) ? SerOption::as_ptr : SerOption::none;
 
+        // Vectors of trivially serializable elements are copied in bulk, unless the elements have to be tracked
+        if constexpr ( is_trivially_serializable_vector_v<OBJ> ) {
+            if ( ser.mode() != serializer::MAP && !SerOption::is_set(options, SerOption::as_ptr_elem) ) {
+                size_t size = obj.size();
+                ser.primitive(size);
+                if ( ser.mode() == serializer::UNPACK ) {
+                    obj.clear();
+                    obj.resize(size);
+                }
+                if ( size ) ser.raw(obj.data(), size * sizeof(value_type));
+                return;
+            }
+        }
+
         switch ( const auto mode = ser.mode() ) {
         case serializer::SIZER:
         case serializer::PACK:
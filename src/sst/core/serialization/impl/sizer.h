@@ -18,11 +18,11 @@
 #endif
 
 #include "sst/core/serialization/impl/get_array_size.h"
+#include "sst/core/serialization/impl/ser_pointer_set.h"
 #include "sst/core/serialization/impl/ser_shared_ptr_tracker.h"
 
 #include <cstddef>
 #include <cstdint>
-#include <set>
 #include <string>
 #include <type_traits>
 
@@ -30,8 +30,8 @@ namespace SST::Core::Serialization::pvt {
 
 class ser_sizer : public ser_shared_ptr_packer
 {
-    size_t              size_ = 0;
-    std::set<uintptr_t> pointer_set;
+    size_t          size_ = 0;
+    ser_pointer_set pointer_set;
 
 public:
     explicit ser_sizer() = default;
@@ -57,7 +57,7 @@ public:
     void   size_string(std::string& str) { size_ += sizeof(size_t) + str.size(); }
     void   add(size_t s) { size_ += s; }
     size_t size() const { return size_; }
-    bool   check_pointer_sizer(uintptr_t ptr) { return !pointer_set.insert(ptr).second; }
+    bool   check_pointer_sizer(uintptr_t ptr) { return pointer_set.insert(ptr); }
 }; // class ser_sizer
 
 } // namespace SST::Core::Serialization::pvt
@@ -28,6 +28,7 @@
 #include <cstdint>
 #include <cstring>
 #include <string>
+#include <utility>
 #include <variant>
 
 namespace SST::Core::Serialization {
@@ -62,6 +63,39 @@ public:
     void start_unpacking(char* buffer, size_t size) { ser_.emplace<UNPACK>(buffer, size); }
     void start_mapping(ObjectMap* obj) { ser_.emplace<MAP>(obj); }
 
+    // Start packing into a buffer owned by the serializer that grows as data is packed.  This avoids the sizing pass
+    // needed to allocate a buffer for start_packing(buffer, size), at the cost of copying the data out of the
+    // serializer with copy_packed().  The buffer is reused by the next call, so it only needs to grow once when the
+    // same objects are packed repeatedly.
+    void start_packing()
+    {
+        chunks_.clear();
+        ser_.emplace<PACK>(&chunks_);
+    }
+
+    // Start packing into buffer, continuing in the serializer's growable buffer once size bytes are used.  If
+    // packed_in_place() is true afterwards, all of the data is in buffer and doesn't need to be copied.  Useful when
+    // the caller reuses a buffer that is usually large enough.
+    void start_packing_into(char* buffer, size_t size)
+    {
+        chunks_.clear(buffer, size);
+        ser_.emplace<PACK>(&chunks_);
+    }
+
+    // Copy the data packed since the last call to start_packing() to dest, which must hold packed_size() bytes.  Can
+    // be called after switching out of PACK mode.
+    void   copy_packed(void* dest) const { chunks_.copy_to(dest); }
+    size_t packed_size() const { return chunks_.size(); }
+    bool   packed_in_place() const { return chunks_.in_place(); }
+
+    // Call f(const char* data, size_t size) on each contiguous piece of the packed data in order, so it can be
+    // written out without first copying it into one buffer
+    template <typename F>
+    void for_each_packed(F&& f) const
+    {
+        chunks_.for_each_chunk(std::forward<F>(f));
+    }
+
     // finalize() destroys the tracking object of the current mode and switches to UNSTARTED mode. Functionally,
     // finalize() indicates the end of a serialization sequence, not just the end of the current mode. You do not
     // need to call finalize() if you are simply changing modes. finalize() can perform any final steps at the end
@@ -139,6 +173,9 @@ public:
     const char* getMapName() const;
 
 private:
+    // Growable buffer used by start_packing() without a buffer.  Declared before ser_ so it outlives the packer.
+    pvt::ser_chunked_buffer chunks_;
+
     // Default mode is UNSTARTED=0 with an empty std::monostate class. SIZER=1, PACK=2, UNPACK=3 and MAP=4 modes have
     // an associated tracking object which is constructed when starting the new mode. finalize() destroys the current
     // mode's tracking object and goes back to UNSTARTED mode.
@@ -273,7 +273,19 @@ public:
 
     void updateState(bool finalize);
 
-    void serialize_order(serializer& ser) { SST_SER(shared_data); }
+    void serialize_order(serializer& ser)
+    {
+        // Data restored from a checkpoint replaces the data already
+        // held, which happens when the simulation is rewound.  As on
+        // restart, SharedObjects may look up their data again.
+        if ( ser.mode() == serializer::UNPACK ) {
+            for ( auto x : shared_data ) {
+                delete x.second;
+            }
+            locked = false;
+        }
+        SST_SER(shared_data);
+    }
 };
 
 class SharedObject : public serializable
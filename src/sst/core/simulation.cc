@@ -24,7 +24,9 @@
 #include "sst/core/interactiveConsole.h"
 #include "sst/core/linkMap.h"
 #include "sst/core/linkPair.h"
+#include "sst/core/memuse.h"
 #include "sst/core/model/configGraph.h"
+#include "sst/core/model/partitionWeights.h"
 #include "sst/core/objectComms.h"
 #include "sst/core/output.h"
 #include "sst/core/profile/clockHandlerProfileTool.h"
@@ -51,13 +53,16 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 #include <exception>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -145,6 +150,129 @@ TimeVortexSort::getActions()
 
 } // namespace pvt
 
+namespace {
+
+// Profile tools installed to collect data for --output-partition-weights
+const std::string partition_weights_tool_prefix = "sst.partition_weights.";
+const std::string partition_weights_profile_tools =
+    "sst.partition_weights.event:sst.profile.handler.event.partition[event];"
+    "sst.partition_weights.clock:sst.profile.handler.clock.partition[clock]";
+
+/**
+   Calls func().  If costs is not nullptr, adds the time taken and the
+   growth of the max RSS to the entry for type in costs.
+ */
+template <typename FUNC>
+void
+trackElementCost(std::map<std::string, Util::RegionDetail>* costs, const std::string& type, FUNC&& func)
+{
+    if ( !costs ) {
+        func();
+        return;
+    }
+
+    double   start_time = sst_get_cpu_time();
+    uint64_t start_mem  = Core::localMemSize();
+    func();
+
+    auto& cost = (*costs)[type];
+    cost.duration += sst_get_cpu_time() - start_time;
+    cost.mem += Core::localMemSize() - start_mem;
+    cost.count++;
+}
+
+/**
+   Streaming version of the 128-bit MurmurHash3 (x64) hash, used to
+   detect component blobs that haven't changed between incremental
+   checkpoints.  The data can be added in pieces of any size, so the
+   packed chunks of a blob can be hashed without copying them into one
+   buffer.
+ */
+class BlobDigest
+{
+public:
+    void update(const char* data, size_t size)
+    {
+        length_ += size;
+        if ( tail_size_ > 0 ) {
+            const size_t count = std::min(size, block_size - tail_size_);
+            std::memcpy(tail_ + tail_size_, data, count);
+            tail_size_ += count;
+            data += count;
+            size -= count;
+            if ( tail_size_ < block_size ) return;
+            mixBlock(tail_);
+            tail_size_ = 0;
+        }
+        for ( ; size >= block_size; data += block_size, size -= block_size ) {
+            mixBlock(data);
+        }
+        std::memcpy(tail_, data, size);
+        tail_size_ = size;
+    }
+
+    std::array<uint64_t, 2> finish()
+    {
+        // Zero padding leaves the state unchanged for the missing bytes
+        std::memset(tail_ + tail_size_, 0, block_size - tail_size_);
+        uint64_t k1, k2;
+        std::memcpy(&k1, tail_, 8);
+        std::memcpy(&k2, tail_ + 8, 8);
+        h2_ ^= rotl(k2 * c2, 33) * c1;
+        h1_ ^= rotl(k1 * c1, 31) * c2;
+
+        h1_ ^= length_;
+        h2_ ^= length_;
+        h1_ += h2_;
+        h2_ += h1_;
+        h1_ = fmix(h1_);
+        h2_ = fmix(h2_);
+        h1_ += h2_;
+        h2_ += h1_;
+        return { h1_, h2_ };
+    }
+
+private:
+    static constexpr size_t   block_size = 16;
+    static constexpr uint64_t c1         = UINT64_C(0x87c37b91114253d5);
+    static constexpr uint64_t c2         = UINT64_C(0x4cf5ad432745937f);
+
+    uint64_t h1_        = 0;
+    uint64_t h2_        = 0;
+    uint64_t length_    = 0;
+    char     tail_[block_size];
+    size_t   tail_size_ = 0;
+
+    static uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+    static uint64_t fmix(uint64_t k)
+    {
+        k ^= k >> 33;
+        k *= UINT64_C(0xff51afd7ed558ccd);
+        k ^= k >> 33;
+        k *= UINT64_C(0xc4ceb9fe1a85ec53);
+        k ^= k >> 33;
+        return k;
+    }
+
+    void mixBlock(const char* block)
+    {
+        uint64_t k1, k2;
+        std::memcpy(&k1, block, 8);
+        std::memcpy(&k2, block + 8, 8);
+
+        h1_ ^= rotl(k1 * c1, 31) * c2;
+        h1_ = rotl(h1_, 27) + h2_;
+        h1_ = h1_ * 5 + 0x52dce729;
+
+        h2_ ^= rotl(k2 * c2, 33) * c1;
+        h2_ = rotl(h2_, 31) + h1_;
+        h2_ = h2_ * 5 + 0x38495ab5;
+    }
+};
+
+} // anonymous namespace
+
 
 Config       Simulation::config;
 StatsConfig* Simulation::stats_config_ = nullptr;
@@ -257,6 +385,9 @@ Simulation::createSimulation(
     instanceVec_.resize(num_ranks.thread);
     instanceVec_[my_rank.thread] = instance;
     instance->initializeProfileTools(config.enabled_profiling());
+    if ( !config.output_partition_weights().empty() ) {
+        instance->initializeProfileTools(partition_weights_profile_tools);
+    }
 
     return instance;
 }
@@ -840,7 +971,8 @@ Simulation::performWireUp(ConfigGraph& graph, const RankInfo& myRank, SimTime_t
                 printf("WARNING: Building component \"%s\" with no links assigned.\n", ccomp->name.c_str());
             }
 
-            tmp = createComponent(ccomp->id, ccomp->type, ccomp->params);
+            trackElementCost(track_element_costs_ ? &construction_costs_ : nullptr, ccomp->type,
+                [&] { tmp = createComponent(ccomp->id, ccomp->type, ccomp->params); });
 
             cinfo->setComponent(tmp);
         }
@@ -858,6 +990,39 @@ Simulation::performWireUp(ConfigGraph& graph, const RankInfo& myRank, SimTime_t
     return 0;
 }
 
+void
+Simulation::reportElementCosts()
+{
+    std::map<std::string, Util::RegionDetail>              construction;
+    std::vector<std::map<std::string, Util::RegionDetail>> init;
+    std::map<std::string, Util::RegionDetail>              setup;
+
+    for ( auto&& instance : instanceVec_ ) {
+        for ( auto& [type, cost] : instance->construction_costs_ )
+            construction[type] += cost;
+        if ( init.size() < instance->init_costs_.size() ) init.resize(instance->init_costs_.size());
+        for ( size_t phase = 0; phase < instance->init_costs_.size(); ++phase ) {
+            for ( auto& [type, cost] : instance->init_costs_[phase] )
+                init[phase][type] += cost;
+        }
+        for ( auto& [type, cost] : instance->setup_costs_ )
+            setup[type] += cost;
+
+        instance->construction_costs_.clear();
+        instance->init_costs_.clear();
+        instance->setup_costs_.clear();
+    }
+
+    for ( auto& [type, cost] : construction )
+        basicPerf.addRegionDetail("construct", type, cost);
+    for ( size_t phase = 0; phase < init.size(); ++phase ) {
+        for ( auto& [type, cost] : init[phase] )
+            basicPerf.addRegionDetail("init", type, cost, "phase " + std::to_string(phase));
+    }
+    for ( auto& [type, cost] : setup )
+        basicPerf.addRegionDetail("setup", type, cost);
+}
+
 void
 Simulation::exchangeLinkInfo()
 {
@@ -897,8 +1062,14 @@ Simulation::initialize()
         if ( my_rank.thread == 0 ) untimed_msg_count = 0;
         initBarrier.wait();
 
+        std::map<std::string, Util::RegionDetail>* costs = nullptr;
+        if ( track_element_costs_ ) {
+            if ( init_costs_.size() <= untimed_phase ) init_costs_.resize(untimed_phase + 1);
+            costs = &init_costs_[untimed_phase];
+        }
+
         for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
-            (*iter)->getComponent()->init(untimed_phase);
+            trackElementCost(costs, (*iter)->getType(), [&] { (*iter)->getComponent()->init(untimed_phase); });
         }
 
         initBarrier.wait();
@@ -979,7 +1150,8 @@ Simulation::setup()
     setupBarrier.wait();
 
     for ( auto iter = compInfoMap.begin(); iter != compInfoMap.end(); ++iter ) {
-        (*iter)->getComponent()->setup();
+        trackElementCost(track_element_costs_ ? &setup_costs_ : nullptr, (*iter)->getType(),
+            [&] { (*iter)->getComponent()->setup(); });
     }
 
     setupBarrier.wait();
@@ -1833,7 +2005,7 @@ Simulation::scheduleCheckpoint()
 
 void
 Simulation::checkpoint_write_globals(int checkpoint_id, const std::string& checkpoint_directory,
-    const std::string& registry_filename, const std::string& globals_filename)
+    const std::string& registry_filename, const std::string& globals_filename, const std::string& index_filename)
 {
     uint64_t local_event_id;
     uint64_t max_event_id;
@@ -1853,19 +2025,26 @@ Simulation::checkpoint_write_globals(int checkpoint_id, const std::string& check
         return;
     }
 
-    std::ofstream fs =
-        filesystem.ofstream(checkpoint_directory + "/" + globals_filename, std::ios::out | std::ios::binary);
-
-    // TODO: Add error checking for file open
+    // The file is built in memory so that it can be compressed
+    std::vector<char> image;
+    auto              write = [&image](const void* data, size_t len) {
+        const char* bytes = static_cast<const char*>(data);
+        image.insert(image.end(), bytes, bytes + len);
+    };
 
     SST::Core::Serialization::serializer ser;
     ser.enable_pointer_tracking();
 
-    size_t            size;
-    std::vector<char> buffer;
+    // Each section is packed in a single pass, then its chunks are
+    // appended to the image after its size
+    auto write_packed = [&ser, &write]() {
+        size_t size = ser.size();
+        write(&size, sizeof(size));
+        ser.for_each_packed(write);
+    };
 
     /* Section 1: Config options */
-    ser.start_sizing();
+    ser.start_packing();
 
     SST_SER(config);
 
@@ -1883,80 +2062,49 @@ Simulation::checkpoint_write_globals(int checkpoint_id, const std::string& check
     SST_SER(arch_);
     SST_SER(os_);
 
-    size = ser.size();
-    buffer.resize(size);
-
-    ser.start_packing(buffer.data(), size);
-
-    SST_SER(config);
-
-    SST_SER(num_ranks.rank);
-    SST_SER(num_ranks.thread);
-    SST_SER(currentSimCycle);
-    SST_SER(currentPriority);
-
-    // Add list of loaded libraries
-    SST_SER(libnames);
-
-    SST_SER(version_);
-    SST_SER(arch_);
-    SST_SER(os_);
-
-    fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    fs.write(buffer.data(), size);
+    write_packed();
 
 
     /* Section 1a: Shared regions */
-    ser.start_sizing();
-    SST_SER(SharedObject::manager);
-
-    size = ser.size();
-    buffer.resize(size);
-
-    ser.start_packing(buffer.data(), size);
+    ser.start_packing();
     SST_SER(SharedObject::manager);
 
-    fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    fs.write(buffer.data(), size);
+    write_packed();
 
 
     /* Section 1b: stats config */
-    ser.start_sizing();
-    SST_SER(stats_config_);
-
-    size = ser.size();
-    buffer.resize(size);
+    Checkpointing::CheckpointProfile* profile = Checkpointing::activeProfile();
+    double                            start   = profile ? sst_get_cpu_time() : 0.0;
 
-    ser.start_packing(buffer.data(), size);
+    ser.start_packing();
     SST_SER(stats_config_);
 
-    fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    fs.write(buffer.data(), size);
+    write_packed();
 
-    /* Section 2: Common data for Simulation */
-    ser.start_sizing();
-    SST_SER(num_ranks);
-    SST_SER(minPart);
-    SST_SER(minPartTC);
-    SST_SER(max_event_id);
-
-    size = ser.size();
-    buffer.resize(size);
+    if ( profile ) {
+        auto& section = profile->sections["statistics"];
+        section.count++;
+        section.bytes += ser.packed_size();
+        section.time += sst_get_cpu_time() - start;
+    }
 
-    ser.start_packing(buffer.data(), size);
+    /* Section 2: Common data for Simulation */
+    ser.start_packing();
     SST_SER(num_ranks);
     SST_SER(minPart);
     SST_SER(minPartTC);
     SST_SER(max_event_id);
 
+    write_packed();
 
-    fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    fs.write(buffer.data(), size);
+    if ( config.checkpoint_compress() && Checkpointing::compressionAvailable() ) {
+        image = Checkpointing::compressFile(image);
+    }
 
-    fs.close();
+    Checkpointing::writeFile(checkpoint_directory + "/" + globals_filename, image.data(), image.size());
 
 
-    std::ofstream fs_reg = filesystem.ofstream(checkpoint_directory + "/" + registry_filename, std::ios::out);
+    std::ostringstream fs_reg;
 
     /* Section 1: Checkpoint info */
     fs_reg << "## Checkpoint #" << checkpoint_id << " at time " << currentSimCycle << " ("
@@ -1983,10 +2131,13 @@ Simulation::checkpoint_write_globals(int checkpoint_id, const std::string& check
 #undef WR
 
     fs_reg << "** (globals): " << globals_filename << std::endl;
+    fs_reg << "** (component index): " << index_filename << std::endl;
     if ( !checkpoint_configgraph_.empty() ) fs_reg << "** (configgraph): ../" << checkpoint_configgraph_ << std::endl;
 
     fs_reg << "** (start component registry):" << std::endl;
-    fs_reg.close();
+
+    std::string registry = fs_reg.str();
+    Checkpointing::writeFile(checkpoint_directory + "/" + registry_filename, registry.data(), registry.size());
 }
 
 void
@@ -2000,82 +2151,240 @@ Simulation::checkpoint_append_registry(const std::string& registry_name, const s
     // the binary checkpoint files are written, each rank/thread will
     // take turns writing their registry data to the file.
 
-    std::ofstream fs = filesystem.ofstream(registry_name, std::ios::out | std::ios::app);
+    std::ostringstream fs;
 
-    // Write out the component offsets
+    // Write out the component offsets.  For incremental checkpoints,
+    // components whose blob is in an earlier checkpoint also list
+    // where the blob is
     fs << "\n** (" << my_rank.rank << ":" << my_rank.thread << "): " << blob_name << std::endl;
     for ( auto x : component_blob_offsets_ ) {
         std::string name = getComponent(x.first)->getName();
-        fs << x.first << " : " << x.second << " (" << name << ")" << std::endl;
+        fs << x.first << " : " << x.second << " (" << name << ")";
+        auto location = component_blob_locations_.find(x.first);
+        if ( location != component_blob_locations_.end() && location->second.file != last_checkpoint_file_ ) {
+            fs << " -> ../" << location->second.file << " @ " << location->second.offset;
+        }
+        fs << std::endl;
     }
-    fs.close();
+
+    std::string registry = fs.str();
+    Checkpointing::writeFile(registry_name, registry.data(), registry.size(), true);
 }
 
 void
-Simulation::checkpoint(const std::string& checkpoint_filename)
-{
-    std::ofstream fs = filesystem.ofstream(checkpoint_filename, std::ios::out | std::ios::binary);
-    // TODO: Add error checking for file open
-
-    SST::Core::Serialization::serializer ser;
-    ser.enable_pointer_tracking();
+Simulation::checkpoint(const std::string& checkpoint_filename, bool incremental, std::vector<char>* aggregate_image)
+{
+    // For asynchronous, compressed, aggregated or memory checkpoints,
+    // the file is built in memory, then compressed by this thread and
+    // handed to the background writer or written.  Otherwise it is
+    // written directly.
+    const bool        async     = config.checkpoint_async();
+    const bool        compress  = config.checkpoint_compress() && Checkpointing::compressionAvailable();
+    const bool        in_memory = async || compress || aggregate_image || Checkpointing::isCapturing();
+    std::ofstream     fs;
+    std::vector<char> image;
+    if ( !in_memory ) {
+        fs = filesystem.ofstream(checkpoint_filename, std::ios::out | std::ios::binary);
+        if ( !fs.is_open() ) {
+            sim_output.fatal(
+                CALL_INFO, 1, "ERROR: Unable to open checkpoint file %s for writing\n", checkpoint_filename.c_str());
+        }
+    }
 
-    /* Section 3: Simulation */
-    ser.start_sizing();
+    auto write = [&](const void* data, size_t len) {
+        if ( in_memory ) {
+            const char* bytes = static_cast<const char*>(data);
+            image.insert(image.end(), bytes, bytes + len);
+        }
+        else {
+            fs.write(static_cast<const char*>(data), len);
+        }
+    };
+    auto offset = [&]() -> size_t { return in_memory ? image.size() : static_cast<size_t>(fs.tellp()); };
 
-    SST_SER(interThreadMinLatency);
-    SST_SER(independent);
+    // Sizes and times are added to the profile if there is one
+    Checkpointing::CheckpointProfile* profile = Checkpointing::activeProfile();
+    double                            start   = profile ? sst_get_cpu_time() : 0.0;
 
     // First we need to get the TimeVortexContents and sort them
     tv_sort_.data.clear();
     timeVortex->getContents(tv_sort_.data);
     tv_sort_.sortData();
 
-    size_t            size = ser.size();
-    std::vector<char> buffer(size);
+    if ( profile ) {
+        auto& section = profile->sections["time_vortex"];
+        section.count += tv_sort_.data.size();
+        section.time += sst_get_cpu_time() - start;
+        start = sst_get_cpu_time();
+    }
+
+    SST::Core::Serialization::serializer ser;
+    ser.enable_pointer_tracking();
+
+    // The pointer tracking of each packing pass is added to the
+    // profile before the next pass replaces the packer
+    auto profile_tracking = [&ser, profile]() {
+        if ( !profile ) return;
+        const auto& pointers = ser.packer().tracked_pointers();
+        auto&       tracking = profile->tracking;
+        tracking.tables++;
+        tracking.pointers += pointers.size();
+        tracking.max_pointers = std::max<uint64_t>(tracking.max_pointers, pointers.size());
+        tracking.capacity += pointers.capacity();
+        tracking.lookups += pointers.lookups();
+        tracking.hits += pointers.hits();
+        tracking.probes += pointers.probes();
+        tracking.shared_ptr_owners += ser.packer().shared_ptr_owners();
+    };
 
-    // Pack buffer
-    ser.start_packing(&buffer[0], size);
+    /* Section 3: Simulation */
+    // Data is packed in a single pass into the serializer's growable
+    // buffer, then its chunks are written out
+    ser.start_packing();
 
     SST_SER(interThreadMinLatency);
     SST_SER(independent);
+    profile_tracking();
 
-    // Write buffer to file
-    fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    fs.write(&buffer[0], size);
+    size_t size = ser.size();
+    write(&size, sizeof(size));
+    ser.for_each_packed(write);
 
     size = compInfoMap.size();
-    fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    write(&size, sizeof(size));
+
+    // The links are serialized as part of the components, but are
+    // profiled separately
+    Checkpointing::CheckpointProfile::Entry links_before;
+    if ( profile ) {
+        auto& section = profile->sections["simulation"];
+        section.count++;
+        section.bytes += offset();
+        section.time += sst_get_cpu_time() - start;
+        links_before = profile->sections["links"];
+    }
 
     // Clear the offsets vector to start this round
     component_blob_offsets_.clear();
+    component_blob_sizes_.clear();
+
+    // Name of this file relative to the base checkpoint directory,
+    // which is how incremental checkpoints refer to earlier files
+    last_checkpoint_file_ = checkpoint_filename;
+    if ( last_checkpoint_file_.compare(0, checkpoint_directory_.size() + 1, checkpoint_directory_ + "/") == 0 ) {
+        last_checkpoint_file_ = last_checkpoint_file_.substr(checkpoint_directory_.size() + 1);
+    }
+    if ( !incremental ) component_blob_locations_.clear();
 
     // Serialize component blobs individually
     for ( auto comp = compInfoMap.begin(); comp != compInfoMap.end(); comp++ ) {
-        ser.start_sizing();
+        if ( profile ) start = sst_get_cpu_time();
         ComponentInfo* compinfo = *comp;
+        ser.start_packing();
         SST_SER(compinfo);
+        profile_tracking();
         size = ser.size();
-        buffer.resize(size);
 
-        ser.start_packing(&buffer[0], size);
-        SST_SER(compinfo);
+        if ( profile ) {
+            const double elapsed = sst_get_cpu_time() - start;
+            for ( auto* entry : { &profile->types[compinfo->type], &profile->sections["components"] } ) {
+                entry->count++;
+                entry->bytes += size;
+                entry->time += elapsed;
+            }
+        }
+
+        component_blob_offsets_.emplace_back(compinfo->id_, offset());
+
+        if ( incremental ) {
+            // If the blob hasn't changed since the last checkpoint,
+            // write a reference to the earlier copy.  A reference is
+            // marked with a size of 0 and holds the file name and
+            // offset of the earlier record.  Blobs are compared by a
+            // 128-bit digest, which includes the size, so a collision
+            // is vanishingly unlikely.
+            BlobDigest hasher;
+            ser.for_each_packed([&hasher](const char* data, size_t len) { hasher.update(data, len); });
+            const std::array<uint64_t, 2> digest   = hasher.finish();
+            auto                          location = component_blob_locations_.find(compinfo->id_);
+            if ( location != component_blob_locations_.end() && location->second.digest == digest ) {
+                size_t marker   = 0;
+                size_t name_len = location->second.file.size();
+                write(&marker, sizeof(marker));
+                write(&name_len, sizeof(name_len));
+                write(location->second.file.data(), name_len);
+                write(&location->second.offset, sizeof(location->second.offset));
+                component_blob_sizes_.push_back(offset() - component_blob_offsets_.back().second);
+                continue;
+            }
+            BlobLocation& last = component_blob_locations_[compinfo->id_];
+            last.digest        = digest;
+            last.file          = last_checkpoint_file_;
+            last.offset        = offset();
+        }
 
-        component_blob_offsets_.emplace_back(compinfo->id_, fs.tellp());
-        fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
-        fs.write(&buffer[0], size);
+        write(&size, sizeof(size));
+        ser.for_each_packed(write);
+        component_blob_sizes_.push_back(sizeof(size) + size);
     }
 
-    fs.close();
+    if ( profile ) {
+        auto& components = profile->sections["components"];
+        auto& links      = profile->sections["links"];
+        components.bytes -= links.bytes - links_before.bytes;
+        components.time -= links.time - links_before.time;
+    }
+
+    if ( aggregate_image ) {
+        *aggregate_image = std::move(image);
+    }
+    else if ( in_memory ) {
+        checkpoint_write_file(checkpoint_filename, std::move(image));
+    }
+    else {
+        fs.close();
+        if ( !fs ) {
+            sim_output.fatal(CALL_INFO, 1, "ERROR: Error writing checkpoint file %s\n", checkpoint_filename.c_str());
+        }
+    }
     tv_sort_.data.clear();
 }
 
 void
-Simulation::restart(ConfigGraph* graph)
+Simulation::checkpoint_write_file(const std::string& checkpoint_filename, std::vector<char>&& image)
 {
-    std::ifstream fs(config.configFile());
+    // Offsets in the registry are offsets in the uncompressed data
+    if ( config.checkpoint_compress() && Checkpointing::compressionAvailable() ) {
+        image = Checkpointing::compressFile(image);
+    }
 
-    std::string checkpoint_directory = config.configFile().substr(0, config.configFile().find_last_of('/'));
+    if ( config.checkpoint_async() && !Checkpointing::isCapturing() ) {
+        CheckpointAction::writer.write(checkpoint_filename, std::move(image));
+    }
+    else {
+        Checkpointing::writeFile(checkpoint_filename, image.data(), image.size());
+    }
+}
+
+void
+Simulation::checkpoint_relocate(uint64_t base)
+{
+    for ( auto& x : component_blob_offsets_ ) {
+        x.second += base;
+    }
+    // Blobs written by the last checkpoint are the ones in its file
+    for ( auto& x : component_blob_locations_ ) {
+        if ( x.second.file == last_checkpoint_file_ ) x.second.offset += base;
+    }
+}
+
+void
+Simulation::restart(ConfigGraph* graph, const std::string& registry_filename)
+{
+    auto          registry_file = Checkpointing::openCheckpointFile(registry_filename);
+    std::istream& fs            = *registry_file;
+
+    std::string checkpoint_directory = registry_filename.substr(0, registry_filename.find_last_of('/'));
 
     std::string line;
 
@@ -2091,7 +2400,8 @@ Simulation::restart(ConfigGraph* graph)
     }
 
     // Open the globals file
-    std::ifstream     fs_globals(globals_filename, std::ios::binary);
+    auto              globals_file = Checkpointing::openCheckpointFile(globals_filename);
+    std::istream&     fs_globals   = *globals_file;
     size_t            size;
     std::vector<char> buffer;
     uint64_t          max_event_id;
@@ -2119,7 +2429,7 @@ Simulation::restart(ConfigGraph* graph)
     SST_SER(minPartTC);
     SST_SER(max_event_id);
 
-    fs_globals.close();
+    globals_file.reset();
 
     // Set the runmode and output directory
     runMode          = config.runMode();
@@ -2136,6 +2446,7 @@ Simulation::restart(ConfigGraph* graph)
     // restart, we will get all the files.  If not, only get the file
     // for current rank
     std::vector<std::string> blob_filenames;
+    std::vector<uint64_t>    blob_offsets;
 
     // Need to set Link::is_restart_same_parallelism flag. If we aren't doing a serial restart or a remap, then we must
     // have the same parallelism or we would have errored before getting here.  The variable is static, but all threads
@@ -2167,8 +2478,17 @@ Simulation::restart(ConfigGraph* graph)
                 while ( std::getline(fs, line) ) {
                     size_t pos = line.find(search_str);
                     if ( pos == 0 ) {
-                        // Get the file name
-                        blob_filenames.push_back(checkpoint_directory + "/" + line.substr(search_str.length()));
+                        // Get the file name.  Partitions in a shared
+                        // file also give the offset of their data
+                        std::string filename = line.substr(search_str.length());
+                        uint64_t    offset   = 0;
+                        size_t      at       = filename.find(" @ ");
+                        if ( at != std::string::npos ) {
+                            offset   = std::stoull(filename.substr(at + 3));
+                            filename = filename.substr(0, at);
+                        }
+                        blob_filenames.push_back(checkpoint_directory + "/" + filename);
+                        blob_offsets.push_back(offset);
                         break;
                     }
                 }
@@ -2176,7 +2496,7 @@ Simulation::restart(ConfigGraph* graph)
         }
     }
 
-    fs.close();
+    registry_file.reset();
 
     ser.enable_pointer_tracking();
 
@@ -2209,30 +2529,28 @@ Simulation::restart(ConfigGraph* graph)
 
         std::string current_filename;
 
-        std::ifstream     fs_blob;
-        std::vector<char> buffer;
-        size_t            size = 0;
+        std::unique_ptr<std::istream> fs_blob;
+        std::vector<char>             buffer;
+        CheckpointFileCache           ref_files;
         for ( auto& x : my_comps ) {
             if ( current_filename != x.first ) {
                 current_filename = x.first;
-                if ( fs_blob.is_open() ) fs_blob.close();
-                fs_blob.open(checkpoint_directory + "/" + current_filename, std::ios::binary);
+                fs_blob          = Checkpointing::openCheckpointFile(checkpoint_directory + "/" + current_filename);
             }
-            fs_blob.seekg(x.second);
-            fs_blob.read(reinterpret_cast<char*>(&size), sizeof(size));
-            buffer.resize(size);
-            fs_blob.read(buffer.data(), size);
-            ser.start_unpacking(buffer.data(), size);
+            fs_blob->seekg(x.second);
+            readComponentBlob(*fs_blob, checkpoint_directory, buffer, ref_files);
+            ser.start_unpacking(buffer.data(), buffer.size());
             // ComponentInfo* compInfo = new ComponentInfo();
             ComponentInfo* compInfo;
             SST_SER(compInfo);
             compInfoMap.insert(compInfo);
         }
-        if ( fs_blob.is_open() ) fs_blob.close();
     }
     else if ( blob_filenames.size() == 1 ) {
         // This is a regular restart (same parallelism as checkpoint)
-        std::ifstream fs_blob(blob_filenames[0], std::ios::binary);
+        auto          blob_file = Checkpointing::openCheckpointFile(blob_filenames[0]);
+        std::istream& fs_blob   = *blob_file;
+        fs_blob.seekg(blob_offsets[0]);
 
         /* Now get the global blob */
         fs_blob.read(reinterpret_cast<char*>(&size), sizeof(size));
@@ -2264,16 +2582,14 @@ Simulation::restart(ConfigGraph* graph)
         fs_blob.read(reinterpret_cast<char*>(&compCount), sizeof(compCount));
 
         // Deserialize component blobs individually
+        CheckpointFileCache ref_files;
         for ( size_t comp = 0; comp < compCount; comp++ ) {
-            fs_blob.read(reinterpret_cast<char*>(&size), sizeof(size));
-            buffer.resize(size);
-            fs_blob.read(&buffer[0], size);
-            ser.start_unpacking(&buffer[0], size);
+            readComponentBlob(fs_blob, checkpoint_directory, buffer, ref_files);
+            ser.start_unpacking(buffer.data(), buffer.size());
             ComponentInfo* compInfo = new ComponentInfo();
             SST_SER(compInfo);
             compInfoMap.insert(compInfo);
         }
-        fs_blob.close();
     }
     else {
         // This is a parallel checkpoint restarted as a serial job
@@ -2286,9 +2602,11 @@ Simulation::restart(ConfigGraph* graph)
         stat_engine.restart();
 
         // Now we need to extract the components from all of the files
-        std::ifstream fs_blob;
-        for ( std::string filename : blob_filenames ) {
-            fs_blob.open(filename, std::ios::binary);
+        CheckpointFileCache ref_files;
+        for ( size_t i = 0; i < blob_filenames.size(); ++i ) {
+            auto          blob_file = Checkpointing::openCheckpointFile(blob_filenames[i]);
+            std::istream& fs_blob   = *blob_file;
+            fs_blob.seekg(blob_offsets[i]);
 
             /* Now get the global blob */
             fs_blob.read(reinterpret_cast<char*>(&size), sizeof(size));
@@ -2310,15 +2628,12 @@ Simulation::restart(ConfigGraph* graph)
 
             // Deserialize component blobs individually
             for ( size_t comp = 0; comp < compCount; comp++ ) {
-                fs_blob.read(reinterpret_cast<char*>(&size), sizeof(size));
-                buffer.resize(size);
-                fs_blob.read(&buffer[0], size);
-                ser.start_unpacking(&buffer[0], size);
+                readComponentBlob(fs_blob, checkpoint_directory, buffer, ref_files);
+                ser.start_unpacking(buffer.data(), buffer.size());
                 ComponentInfo* compInfo = new ComponentInfo();
                 SST_SER(compInfo);
                 compInfoMap.insert(compInfo);
             }
-            fs_blob.close();
         }
     }
 
@@ -2348,6 +2663,48 @@ Simulation::restart(ConfigGraph* graph)
     // real_time_->begin();
 }
 
+void
+Simulation::readComponentBlob(std::istream& fs, const std::string& checkpoint_directory, std::vector<char>& buffer,
+    CheckpointFileCache& ref_files)
+{
+    size_t size = 0;
+    fs.read(reinterpret_cast<char*>(&size), sizeof(size));
+
+    if ( size == 0 ) {
+        // Reference to a blob in an earlier checkpoint.  The file name
+        // is relative to the base checkpoint directory, which is the
+        // parent of this checkpoint's directory.
+        size_t name_len = 0;
+        fs.read(reinterpret_cast<char*>(&name_len), sizeof(name_len));
+        std::string file(name_len, '\0');
+        fs.read(&file[0], name_len);
+        uint64_t offset = 0;
+        fs.read(reinterpret_cast<char*>(&offset), sizeof(offset));
+
+        // Many references point into the same few files, so each
+        // file is only opened once
+        auto& fs_ref = ref_files[file];
+        if ( !fs_ref ) {
+            std::string path = checkpoint_directory + "/../" + file;
+            fs_ref           = Checkpointing::openCheckpointFile(path);
+            if ( !*fs_ref ) {
+                sim_output.fatal(CALL_INFO, 1,
+                    "ERROR: Unable to open %s, which holds component data for an incremental checkpoint\n",
+                    path.c_str());
+            }
+        }
+        fs_ref->clear();
+        fs_ref->seekg(offset);
+        fs_ref->read(reinterpret_cast<char*>(&size), sizeof(size));
+        buffer.resize(size);
+        fs_ref->read(buffer.data(), size);
+        return;
+    }
+
+    buffer.resize(size);
+    fs.read(buffer.data(), size);
+}
+
 void
 Simulation::checkIndependent()
 {
@@ -2631,12 +2988,32 @@ Simulation::printProfilingInfo(Util::PerfReporter* reporter)
     if ( profile_tools.size() == 0 ) return;
 
     for ( auto tool : profile_tools ) {
+        // Tools added for --output-partition-weights are written by
+        // addPartitionWeights() instead
+        if ( tool.first.rfind(partition_weights_tool_prefix, 0) == 0 ) continue;
+
         // Creates record if it does not yet exist on this rank, otherwise acquires record pointer
         auto record = reporter->createDataRecord(tool.first);
         tool.second->outputData(record, my_rank);
     }
 }
 
+void
+Simulation::addPartitionWeights(PartitionWeights& weights)
+{
+    // Modifying shared state so serialize threads through this function
+    std::lock_guard<std::mutex> lock(simulationMutex);
+
+    for ( auto tool : profile_tools ) {
+        if ( auto* event_tool = dynamic_cast<Profile::EventHandlerProfileToolPartition*>(tool.second) ) {
+            event_tool->addPartitionWeights(weights);
+        }
+        else if ( auto* clock_tool = dynamic_cast<Profile::ClockHandlerProfileToolPartition*>(tool.second) ) {
+            clock_tool->addPartitionWeights(weights);
+        }
+    }
+}
+
 #if SST_PERFORMANCE_INSTRUMENTING
 void
 Simulation::printPerformanceInfo()
@@ -2700,6 +3077,7 @@ std::string                Simulation::checkpoint_directory_   = "";
 std::string                Simulation::checkpoint_configgraph_ = "";
 
 Util::BasicPerfTracker Simulation::basicPerf;
+bool                   Simulation::track_element_costs_ = false;
 
 
 /* Define statics (Simulation) */
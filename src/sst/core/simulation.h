@@ -28,11 +28,14 @@
 #include "sst/core/util/basicPerf.h"
 #include "sst/core/util/filesystem.h"
 
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <signal.h>
@@ -64,6 +67,7 @@ class InteractiveConsole;
 class Link;
 class LinkMap;
 class Params;
+class PartitionWeights;
 class RealTimeManager;
 class SimulatorHeartbeat;
 class SyncBase;
@@ -223,6 +227,21 @@ public:
     int  performWireUp(ConfigGraph& graph, const RankInfo& myRank, SimTime_t min_part);
     void exchangeLinkInfo();
 
+    /**
+     * Enables tracking of the startup cost (time and growth of the
+     * max RSS) of each element type during construction, init() and
+     * setup().  Must be called before the components are constructed.
+     */
+    static void setElementCostTracking(bool enable) { track_element_costs_ = enable; }
+
+    /**
+     * Adds the startup costs tracked since the last call, summed over
+     * all threads on this rank, as details of the "construct", "init"
+     * and "setup" perf regions.  Must be called from a single thread
+     * while the other threads are waiting at a barrier.
+     */
+    static void reportElementCosts();
+
     /** Functions to compute the current rank and thread sync intervals */
     void findRankSyncInterval();
     void findThreadSyncInterval();
@@ -262,6 +281,12 @@ public:
 
     void printProfilingInfo(Util::PerfReporter* reporter);
 
+    /**
+       Adds the component costs and link traffic measured by the
+       partition profile tools to weights
+    */
+    void addPartitionWeights(PartitionWeights& weights);
+
     void printPerformanceInfo();
 
 
@@ -409,8 +434,35 @@ public:
 
     /**
        Write the partition specific checkpoint data
+
+       @param checkpoint_filename File to write
+       @param incremental If true, components whose serialized state
+       is the same as in the previous checkpoint are written as a
+       reference to the blob in the earlier file instead of a copy
+       @param aggregate_image If not nullptr, the data is returned here
+       instead of being written, so it can be aggregated with other
+       partitions into a shared file
+     */
+    void checkpoint(
+        const std::string& checkpoint_filename, bool incremental = false, std::vector<char>* aggregate_image = nullptr);
+
+    /**
+       Write a checkpoint file, compressing it and handing it to the
+       background writer if those options are on
+
+       @param checkpoint_filename File to write
+       @param image Contents of the file
+     */
+    void checkpoint_write_file(const std::string& checkpoint_filename, std::vector<char>&& image);
+
+    /**
+       Move the data returned by the last call to checkpoint() to
+       offset base in a shared checkpoint file by adjusting the
+       recorded component offsets
+
+       @param base Offset of the partition's data in the shared file
      */
-    void checkpoint(const std::string& checkpoint_filename);
+    void checkpoint_relocate(uint64_t base);
 
     /**
        Append partitions registry information
@@ -422,8 +474,30 @@ public:
        and write the header info
      */
     void checkpoint_write_globals(int checkpoint_id, const std::string& checkpoint_filename,
-        const std::string& registry_filename, const std::string& globals_filename);
-    void restart(ConfigGraph* graph);
+        const std::string& registry_filename, const std::string& globals_filename, const std::string& index_filename);
+
+    /**
+       Restore the partition from a checkpoint
+
+       @param graph Graph created from the checkpoint's registry
+       @param registry_filename Registry of the checkpoint
+     */
+    void restart(ConfigGraph* graph, const std::string& registry_filename);
+
+    /**
+       Read a component blob record from a checkpoint file.  Records
+       in incremental checkpoints may refer to a blob in an earlier
+       checkpoint, in which case the blob is read from that file.
+
+       @param fs Stream positioned at the start of the record
+       @param checkpoint_directory Directory of the checkpoint being read
+       @param buffer Filled with the blob
+       @param ref_files Files opened to read referenced blobs, keyed by
+       name relative to the base checkpoint directory
+     */
+    using CheckpointFileCache = std::map<std::string, std::unique_ptr<std::istream>>;
+    static void readComponentBlob(std::istream& fs, const std::string& checkpoint_directory, std::vector<char>& buffer,
+        CheckpointFileCache& ref_files);
 
     void discoverRemoteLinks();
 
@@ -579,6 +653,28 @@ public:
      */
     std::vector<std::pair<ComponentId_t, uint64_t>> component_blob_offsets_;
 
+    /** Size of each record in component_blob_offsets_ */
+    std::vector<uint64_t> component_blob_sizes_;
+
+    /**
+       Where the blob of each component was last written, used for
+       incremental checkpoints.  file is relative to the base
+       checkpoint directory and offset is the offset of the blob's
+       record in that file.  Only a 128-bit digest of the blob is kept,
+       so that tracking the blobs doesn't double the memory used by
+       large models.
+     */
+    struct BlobLocation
+    {
+        std::array<uint64_t, 2> digest;
+        std::string             file;
+        uint64_t                offset;
+    };
+    std::unordered_map<ComponentId_t, BlobLocation> component_blob_locations_;
+
+    /** File written by the last call to checkpoint(), relative to the base checkpoint directory */
+    std::string last_checkpoint_file_;
+
     pvt::TimeVortexSort tv_sort_;
 
     /** TimeLord of the simulation */
@@ -695,6 +791,17 @@ public:
     double complete_phase_start_time_;
     double complete_phase_total_time_;
 
+    /**
+     * Startup cost of the components on this thread, by element type.
+     * Init costs are kept per init phase.  Memory growth is process
+     * wide, so when threads run concurrently growth caused by one
+     * thread may be charged to the type running on another.
+     */
+    std::map<std::string, Util::RegionDetail>              construction_costs_;
+    std::vector<std::map<std::string, Util::RegionDetail>> init_costs_;
+    std::map<std::string, Util::RegionDetail>              setup_costs_;
+    static bool                                            track_element_costs_;
+
     static std::unordered_map<std::thread::id, Simulation*> instanceMap;
     static std::vector<Simulation*>                         instanceVec_;
 
@@ -18,6 +18,7 @@
 #include "sst/core/elemLoader.h"
 #include "sst/core/env/envconfig.h"
 #include "sst/core/env/envquery.h"
+#include "sst/core/graphGenerator.h"
 #include "sst/core/model/element_python.h"
 #include "sst/core/sstpart.h"
 #include "sst/core/statapi/statbase.h"
@@ -215,7 +216,7 @@ parseInput(std::string input)
             text =
                 "\n~=== SST-INFO ===~\n"
                 "This program lists documented Components, SubComponents, Modules, PortModules, Partitioners, "
-                "ProfileTools, StatisticOutputs, and Statistic types within an Element Library.\n\n"
+                "GraphGenerators, ProfileTools, StatisticOutputs, and Statistic types within an Element Library.\n\n"
                 "~=== CONTROLS ===~\n"
                 "The 'Console' window contains a command-line style input box. Typed input will appear here.\n"
                 "The text window can be resized, and both arrow key and mouse scrolling is enabled.\n"
@@ -630,6 +631,10 @@ processSSTElementFiles()
         addELI(loader, l, g_configuration.processAllElements());
     }
 
+    // Record what was found so sst can find libraries without
+    // searching for them
+    if ( g_configuration.writeElemlibIndex() ) loader.updateIndex();
+
     // Store info strings for interactive mode
     if ( g_configuration.interactiveEnabled() ) {
         for ( size_t x = 0; x < g_libInfoArray.size(); x++ ) {
@@ -767,6 +772,11 @@ SSTInfoConfig::SSTInfoConfig(bool suppress_print) :
         "Element libraries to process (all, <element>) [default: all]. <element> can be an element library, or it can "
         "be a single element within the library.",
         libs_, false);
+    DEF_FLAG("write-elemlib-index", 0,
+        "Write an index of the element library files in the library path, which lets sst load libraries without "
+        "searching for them.  The index is written to the file named by SST_CORE_ELEMLIB_INDEX, or to "
+        "~/.sst/elemlib_index if it is not set.",
+        writeElemlibIndex_);
     addLibraryPathOptions();
 
     DEF_SECTION_HEADING("Advanced Options - Environment");
@@ -1036,6 +1046,7 @@ SSTLibraryInfo::setAllLibraryInfo()
     setAllLibraryInfo<Module>();
     setAllLibraryInfo<PortModule>();
     setAllLibraryInfo<SST::Partition::SSTPartitioner>();
+    setAllLibraryInfo<SST::GraphGenerator>();
     setAllLibraryInfo<SST::Profile::ProfileTool>();
 }
 
@@ -1088,6 +1099,7 @@ SSTLibraryInfo::outputHumanReadable(std::ostream& os, int LibIndex)
     outputHumanReadable<Module>(os, enableFullElementOutput);
     outputHumanReadable<PortModule>(os, enableFullElementOutput);
     outputHumanReadable<SST::Partition::SSTPartitioner>(os, enableFullElementOutput);
+    outputHumanReadable<SST::GraphGenerator>(os, enableFullElementOutput);
     outputHumanReadable<SST::Profile::ProfileTool>(os, enableFullElementOutput);
     outputHumanReadable<SST::SSTElementPythonModule>(os, enableFullElementOutput);
     outputHumanReadable<SST::Statistics::StatisticOutput>(os, enableFullElementOutput);
@@ -1132,6 +1144,7 @@ SSTLibraryInfo::outputXML(int LibIndex, TiXmlNode* XMLParentElement)
     outputXML<Module>(XMLLibraryElement);
     outputXML<PortModule>(XMLLibraryElement);
     outputXML<SST::Partition::SSTPartitioner>(XMLLibraryElement);
+    outputXML<SST::GraphGenerator>(XMLLibraryElement);
     XMLParentElement->LinkEndChild(XMLLibraryElement);
 }
 
@@ -126,6 +126,11 @@ private:
     SST_CONFIG_DECLARE_OPTION(bool, interactiveEnabled, false, &StandardConfigParsers::flag_set_true);
 
 
+    // Library and Path Options
+
+    SST_CONFIG_DECLARE_OPTION(bool, writeElemlibIndex, false, &StandardConfigParsers::flag_set_true);
+
+
     // XML Options
 
     int parseXML(const std::string& UNUSED(arg))
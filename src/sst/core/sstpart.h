@@ -62,7 +62,21 @@ public:
     virtual bool requiresConfigGraph() { return false; }
 
     virtual bool spawnOnAllRanks() { return false; }
-    // virtual bool supportsPartialPartitionInput() { return false; }
+
+    /** Function to be overridden by subclasses
+     *
+     * Returns true if the partitioner can be used with
+     * --parallel-load.  In that case, performPartition(PartitionGraph*)
+     * is called on every rank with only the components loaded on that
+     * rank and must leave each component on the rank it was loaded
+     * on.  If requiresConfigGraph() also returns true,
+     * performPartition(ConfigGraph*) is called on every rank instead
+     * and the partitioner may move components to other ranks, but is
+     * then responsible for moving their configuration there (see
+     * ConfigGraph::redistributeComponents()).  Otherwise, the ranks
+     * and threads set by the model are used.
+     */
+    virtual bool supportsPartialPartitionInput() { return false; }
 };
 
 } // namespace Partition
@@ -83,9 +83,17 @@ RankSyncQueue::getData()
 {
     std::scoped_lock lock(slock);
 
-    serializer ser;
-
-    ser.start_sizing();
+    // Pack in a single pass directly after the header.  If the data
+    // doesn't fit, the serializer continues in its own buffer and the
+    // data is copied into a larger buffer, which is kept so this is
+    // rare once the queue reaches its typical size.
+    serializer&  ser    = ser_;
+    const size_t header = sizeof(RankSyncQueue::Header);
+
+    if ( buffer != nullptr )
+        ser.start_packing_into(buffer + header, buf_size - header);
+    else
+        ser.start_packing();
 
     SST_SER(activities);
 
@@ -93,18 +101,14 @@ RankSyncQueue::getData()
 
     if ( profile_tools_ ) profile_tools_->updateSyncSize(size, activities.size());
 
-    if ( buf_size < (size + sizeof(RankSyncQueue::Header)) ) {
-        if ( buffer != nullptr ) {
-            delete[] buffer;
-        }
-
-        buf_size = size + sizeof(RankSyncQueue::Header);
-        buffer   = new char[buf_size];
+    if ( !ser.packed_in_place() ) {
+        buf_size         = size + header;
+        char* new_buffer = new char[buf_size];
+        ser.copy_packed(new_buffer + header);
+        delete[] buffer;
+        buffer = new_buffer;
     }
-
-    ser.start_packing(buffer + sizeof(RankSyncQueue::Header), size);
-
-    SST_SER(activities);
+    ser.finalize();
 
     // Delete all the events
     for ( unsigned int i = 0; i < activities.size(); i++ ) {
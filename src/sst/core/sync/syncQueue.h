@@ -14,6 +14,7 @@
 
 #include "sst/core/activityQueue.h"
 #include "sst/core/rankInfo.h"
+#include "sst/core/serialization/serializer.h"
 #include "sst/core/threadsafe.h"
 
 #include <cstddef>
@@ -93,6 +94,9 @@ private:
     std::vector<Activity*>        activities;
     Profile::SyncProfileToolList* profile_tools_ = nullptr;
 
+    // Kept between calls to getData() so its packing buffer is reused
+    Core::Serialization::serializer ser_;
+
     Core::ThreadSafe::Spinlock slock;
 };
 
@@ -16,6 +16,7 @@
 #include "sst/core/testElements/coreTest_Serialization.h"
 
 #include "sst/core/componentInfo.h"
+#include "sst/core/cputimer.h"
 #include "sst/core/link.h"
 #include "sst/core/objectSerialization.h"
 #include "sst/core/rng/mersenne.h"
@@ -25,6 +26,7 @@
 
 #include <array>
 #include <bitset>
+#include <complex>
 #include <deque>
 #include <forward_list>
 #include <iostream>
@@ -961,6 +963,158 @@ testSharedPtr(Output& output, const std::unique_ptr<SST::RNG::Random>& rng)
     });
 }
 
+// Pack data with a sizing pass into a fixed size buffer and in a single pass into the serializer's growable buffer,
+// returning both results
+template <typename T>
+std::pair<std::vector<char>, std::vector<char>>
+packBothWays(T& data, bool with_tracking)
+{
+    SST::Core::Serialization::serializer ser;
+    ser.enable_pointer_tracking(with_tracking);
+
+    ser.start_sizing();
+    SST_SER(data);
+    std::vector<char> two_pass(ser.size());
+    ser.start_packing(two_pass.data(), two_pass.size());
+    SST_SER(data);
+
+    ser.start_packing();
+    SST_SER(data);
+    std::vector<char> single_pass(ser.size());
+    ser.copy_packed(single_pass.data());
+
+    ser.finalize();
+    return { two_pass, single_pass };
+}
+
+// Packing into a caller's buffer must produce the expected bytes whether or not they fit, and the data must only be
+// reported as in place when it fits.  The buffer is sized to fit, then too small, then to fit again, so the
+// serializer's own buffer is reused between calls.
+template <typename T>
+bool
+checkPackingInto(T& data, bool with_tracking, const std::vector<char>& expected)
+{
+    SST::Core::Serialization::serializer ser;
+    ser.enable_pointer_tracking(with_tracking);
+
+    for ( size_t capacity : { expected.size(), expected.size() / 2, expected.size() } ) {
+        std::vector<char> buffer(capacity);
+        ser.start_packing_into(buffer.data(), buffer.size());
+        SST_SER(data);
+
+        std::vector<char> packed;
+        ser.for_each_packed(
+            [&packed](const char* chunk, size_t size) { packed.insert(packed.end(), chunk, chunk + size); });
+
+        const bool fits = capacity == expected.size();
+        if ( packed != expected || ser.packed_in_place() != fits || (fits && buffer != expected) ) return false;
+    }
+
+    // Packing into the serializer's own buffer afterwards must not use the caller's buffer
+    ser.start_packing();
+    SST_SER(data);
+    std::vector<char> packed(ser.size());
+    ser.copy_packed(packed.data());
+    ser.finalize();
+    return packed == expected;
+}
+
+// Single pass packing must produce the same bytes as sizing then packing, including when packing into a caller's
+// buffer.  Without pointer tracking, which stores addresses, unpacking the result and packing it again must also
+// produce the same bytes.
+template <typename T>
+bool
+checkSinglePassPacking(T& data, bool with_tracking = false)
+{
+    auto [two_pass, single_pass] = packBothWays(data, with_tracking);
+    if ( two_pass != single_pass ) return false;
+    if ( !checkPackingInto(data, with_tracking, single_pass) ) return false;
+    if ( with_tracking ) return true;
+
+    T                                    out {};
+    SST::Core::Serialization::serializer ser;
+    ser.start_unpacking(single_pass.data(), single_pass.size());
+    SST_SER(out);
+    ser.finalize();
+    return packBothWays(out, false).second == single_pass;
+}
+
+// Pack a vector as its size followed by each element serialized separately, which is the format bulk copying of
+// trivially serializable elements must reproduce
+template <typename T>
+std::vector<char>
+packElementwise(std::vector<T>& data, bool with_tracking)
+{
+    SST::Core::Serialization::serializer ser;
+    ser.enable_pointer_tracking(with_tracking);
+
+    ser.start_packing();
+    size_t size = data.size();
+    ser.primitive(size);
+    for ( auto& e : data )
+        SST_SER(e);
+    std::vector<char> buffer(ser.size());
+    ser.copy_packed(buffer.data());
+
+    ser.finalize();
+    return buffer;
+}
+
+// A vector of trivially serializable elements must pack to the same bytes as packing it element by element, and
+// unpacking the result and packing it again must also produce the same bytes
+template <typename T>
+bool
+checkBulkCopy(std::vector<T>& data)
+{
+    static_assert(SST::Core::Serialization::is_trivially_serializable_vector_v<std::vector<T>>);
+    for ( bool with_tracking : { false, true } ) {
+        auto [two_pass, single_pass] = packBothWays(data, with_tracking);
+        if ( two_pass != single_pass || single_pass != packElementwise(data, with_tracking) ) return false;
+
+        std::vector<T>                       out(3); // Unpacking must replace any existing elements
+        SST::Core::Serialization::serializer ser;
+        ser.enable_pointer_tracking(with_tracking);
+        ser.start_unpacking(single_pass.data(), single_pass.size());
+        SST_SER(out);
+        ser.finalize();
+        if ( out.size() != data.size() || packBothWays(out, with_tracking).second != single_pass ) return false;
+    }
+    return true;
+}
+
+// Time sizing then packing against single pass packing
+template <typename T>
+void
+benchmarkPacking(Output& out, const char* name, T& data, bool with_tracking, int iterations)
+{
+    SST::Core::Serialization::serializer ser;
+    ser.enable_pointer_tracking(with_tracking);
+    std::vector<char> buffer;
+
+    double start = sst_get_cpu_time();
+    for ( int i = 0; i < iterations; ++i ) {
+        ser.start_sizing();
+        SST_SER(data);
+        buffer.resize(ser.size());
+        ser.start_packing(buffer.data(), buffer.size());
+        SST_SER(data);
+    }
+    double two_pass = (sst_get_cpu_time() - start) / iterations;
+
+    start = sst_get_cpu_time();
+    for ( int i = 0; i < iterations; ++i ) {
+        ser.start_packing();
+        SST_SER(data);
+        buffer.resize(ser.size());
+        ser.copy_packed(buffer.data());
+    }
+    double single_pass = (sst_get_cpu_time() - start) / iterations;
+    ser.finalize();
+
+    out.output("%-48s %10zu bytes  size+pack %10.3f us  single pass %10.3f us  speedup %5.2fx\n", name,
+        buffer.size(), two_pass * 1e6, single_pass * 1e6, single_pass > 0.0 ? two_pass / single_pass : 0.0);
+}
+
 coreTestSerialization::coreTestSerialization(ComponentId_t id, Params& params) :
     Component(id)
 {
@@ -1533,6 +1687,26 @@ coreTestSerialization::coreTestSerialization(ComponentId_t id, Params& params) :
             out.output("ERROR: serializing two pointers to the same object did not work properly\n");
         }
     }
+    else if ( test == "pointer_set" ) {
+        // The hash table used for pointer tracking must agree with std::set as it grows, and count its lookups
+        SST::Core::Serialization::pvt::ser_pointer_set pointers;
+        std::set<uintptr_t>                            reference;
+        size_t                                         hits = 0;
+
+        passed = true;
+        for ( int i = 0; i < 100000; ++i ) {
+            // Aligned addresses with repeats, like the pointers in a checkpoint
+            uintptr_t ptr  = 0x10000 + 16 * uintptr_t(rng->generateNextUInt32() % 50000);
+            bool      seen = !reference.insert(ptr).second;
+            if ( seen ) ++hits;
+            if ( pointers.insert(ptr) != seen ) passed = false;
+        }
+        if ( !passed ) out.output("ERROR: ser_pointer_set did not match std::set\n");
+
+        if ( pointers.size() != reference.size() || pointers.lookups() != 100000 || pointers.hits() != hits ||
+             pointers.capacity() < 2 * pointers.size() || pointers.probes() < pointers.lookups() )
+            out.output("ERROR: ser_pointer_set statistics are not consistent\n");
+    }
     else if ( test == "handler" ) {
 
         // Test serialization of handlers
@@ -1803,6 +1977,124 @@ coreTestSerialization::coreTestSerialization(ComponentId_t id, Params& params) :
                        "serialize/deserialize properly\n");
         }
     }
+    else if ( test == "single_pass" || test == "packing_benchmark" ) {
+        // Data large enough to span several chunks of the growable buffer
+        std::vector<int32_t> vector_in(100000);
+        for ( auto& x : vector_in )
+            x = rng->generateNextInt32();
+
+        std::map<int32_t, std::string> map_in;
+        for ( int i = 0; i < 10000; ++i )
+            map_in[rng->generateNextInt32()] = std::string(rng->generateNextUInt32() % 64, 'a' + i % 26);
+
+        // Strings longer than a chunk
+        std::vector<std::string> strings_in;
+        for ( int i = 0; i < 4; ++i )
+            strings_in.emplace_back(100000 + rng->generateNextUInt32() % 100000, 'a' + i);
+
+        std::map<unsigned, std::pair<unsigned, std::vector<unsigned>>> complex_in;
+        for ( unsigned i = 0; i < 1000; ++i ) {
+            complex_in[i].first = rng->generateNextUInt32();
+            complex_in[i].second.resize(rng->generateNextUInt32() % 32, i);
+        }
+
+        // Pointer rich data with shared objects
+        std::vector<pointed_to_class*> pointees;
+        std::vector<shell*>            shells_in;
+        for ( int i = 0; i < 100; ++i )
+            pointees.push_back(new pointed_to_class(i));
+        for ( int i = 0; i < 10000; ++i )
+            shells_in.push_back(new shell(i, pointees[rng->generateNextUInt32() % pointees.size()]));
+
+        if ( test == "single_pass" ) {
+            if ( !checkSinglePassPacking(vector_in) )
+                out.output("ERROR: single pass packing of vector<int32_t> did not match\n");
+            if ( !checkSinglePassPacking(map_in) )
+                out.output("ERROR: single pass packing of map<int32_t,string> did not match\n");
+            if ( !checkSinglePassPacking(strings_in) )
+                out.output("ERROR: single pass packing of vector<string> did not match\n");
+            if ( !checkSinglePassPacking(complex_in) )
+                out.output(
+                    "ERROR: single pass packing of map<unsigned,pair<unsigned,vector<unsigned>>> did not match\n");
+            if ( !checkSinglePassPacking(shells_in, true) )
+                out.output("ERROR: single pass packing of vector<shell*> did not match\n");
+        }
+        else {
+            // Not part of the test suite since the output depends on the machine
+            int iterations = params.find<int>("iterations", 100);
+            benchmarkPacking(out, "vector<int32_t>", vector_in, false, iterations);
+            benchmarkPacking(out, "map<int32_t,string>", map_in, false, iterations);
+            benchmarkPacking(out, "vector<string>", strings_in, false, iterations);
+            benchmarkPacking(out, "map<unsigned,pair<unsigned,vector<unsigned>>>", complex_in, false, iterations);
+            benchmarkPacking(out, "vector<shell*> (pointer tracking)", shells_in, true, iterations);
+        }
+
+        for ( auto* s : shells_in )
+            delete s;
+        for ( auto* p : pointees )
+            delete p;
+    }
+    else if ( test == "bulk_copy" ) {
+        std::vector<int32_t> int_in(10000);
+        for ( auto& x : int_in )
+            x = rng->generateNextInt32();
+        if ( !checkBulkCopy(int_in) ) out.output("ERROR: bulk copy of vector<int32_t> did not match\n");
+
+        std::vector<double> double_in(1000);
+        for ( auto& x : double_in )
+            x = rng->nextUniform();
+        if ( !checkBulkCopy(double_in) ) out.output("ERROR: bulk copy of vector<double> did not match\n");
+
+        std::vector<std::complex<float>> complex_in(1000);
+        for ( auto& x : complex_in )
+            x = { (float)rng->nextUniform(), (float)rng->nextUniform() };
+        if ( !checkBulkCopy(complex_in) ) out.output("ERROR: bulk copy of vector<complex<float>> did not match\n");
+
+        enum class color : uint8_t { red, green, blue };
+        std::vector<color> enum_in(1000);
+        for ( auto& x : enum_in )
+            x = color(rng->generateNextUInt32() % 3);
+        if ( !checkBulkCopy(enum_in) ) out.output("ERROR: bulk copy of vector<enum> did not match\n");
+
+        std::vector<std::array<uint16_t, 3>> array_in(1000);
+        for ( auto& x : array_in )
+            x = { (uint16_t)rng->generateNextUInt32(), (uint16_t)rng->generateNextUInt32(),
+                (uint16_t)rng->generateNextUInt32() };
+        if ( !checkBulkCopy(array_in) ) out.output("ERROR: bulk copy of vector<array<uint16_t,3>> did not match\n");
+
+        struct S
+        {
+            int64_t a;
+            double  x;
+            int32_t b;
+        };
+        std::vector<S> aggregate_in(1000);
+        for ( auto& x : aggregate_in )
+            x = { rng->generateNextInt64(), rng->nextUniform(), rng->generateNextInt32() };
+        if ( !checkBulkCopy(aggregate_in) ) out.output("ERROR: bulk copy of vector<aggregate> did not match\n");
+
+        std::vector<uint64_t> empty_in;
+        if ( !checkBulkCopy(empty_in) ) out.output("ERROR: bulk copy of empty vector<uint64_t> did not match\n");
+
+        // Elements serialized with as_ptr_elem are still tracked one by one, so pointers to them are restored
+        std::vector<int32_t> tracked_in(int_in.begin(), int_in.begin() + 100), tracked_out;
+        int32_t*             elem_in = &tracked_in[42];
+        int32_t*             elem_out {};
+
+        SST::Core::Serialization::serializer ser;
+        ser.enable_pointer_tracking();
+        ser.start_packing();
+        SST_SER(tracked_in, SerOption::as_ptr_elem);
+        SST_SER(elem_in);
+        std::vector<char> buffer(ser.size());
+        ser.copy_packed(buffer.data());
+        ser.start_unpacking(buffer.data(), buffer.size());
+        SST_SER(tracked_out, SerOption::as_ptr_elem);
+        SST_SER(elem_out);
+        ser.finalize();
+        if ( tracked_out != tracked_in || elem_out != &tracked_out[42] )
+            out.output("ERROR: vector<int32_t> serialized with as_ptr_elem did not track its elements\n");
+    }
     else {
         out.fatal(CALL_INFO_LONG, 1, "ERROR: Unknown serialization test specified: %s\n", test.c_str());
     }
@@ -19,8 +19,10 @@
 #include "sst/core/sst_mpi.h"
 #include "sst/core/util/perfReporter.h"
 
+#include <algorithm>
 #include <clocale>
 #include <cstdio>
+#include <iterator>
 
 namespace SST::Util {
 
@@ -185,6 +187,21 @@ BasicPerfTracker::endRegion(const std::string& tag)
     region.rollup_end_mem_max_rank = location;
 }
 
+void
+BasicPerfTracker::addRegionDetail(
+    const std::string& tag, const std::string& name, const RegionDetail& detail, const std::string& group)
+{
+    RegionPerfInfo& region = getRegion(tag, "addRegionDetail", false);
+
+    auto it = std::find_if(
+        region.details.begin(), region.details.end(), [&group](const auto& x) { return x.first == group; });
+    if ( it == region.details.end() ) {
+        region.details.emplace_back(group, std::map<std::string, RegionDetail>());
+        it = std::prev(region.details.end());
+    }
+    it->second[name] += detail;
+}
+
 
 double
 BasicPerfTracker::getRegionBeginTime(const std::string& tag)
@@ -308,7 +325,9 @@ BasicPerfTracker::outputRegionData(size_t verbose, PerfReporter* reporter)
     std::map<std::string, std::pair<std::string, std::string>> keys = {
         { "regions", { "Simulation Resource Utilization for Code Regions", "" } },
         { "total_memory", { "Total Memory", "" } }, { "duration", { "Duration", "s" } },
-        { "max_local_memory", { "Max Local Memory", "" } }, { "max_local_memory_rank", { "Max Local Memory Rank", "" } }
+        { "max_local_memory", { "Max Local Memory", "" } },
+        { "max_local_memory_rank", { "Max Local Memory Rank", "" } }, { "count", { "Count", "" } },
+        { "memory_growth", { "Memory Growth", "" } }
     };
     DataRecord* record = reporter->createDataRecord("regions", DataRecord::TextFormat::tree);
     record->setKeys(keys);
@@ -357,9 +376,39 @@ BasicPerfTracker::outputRegionData(size_t verbose, PerfReporter* reporter)
         else {
             record->addData("total_memory", mem_size_global_us);
         }
+
+        // Details are reported at the level below the region
+        if ( x.level >= verbose ) continue;
+        for ( auto& [group, entries] : x.details ) {
+            if ( group != "" ) {
+                RegionDetail total;
+                for ( auto& entry : entries )
+                    total += entry.second;
+                addDetailRecord(record, keys, group, total);
+            }
+            for ( auto& [name, detail] : entries ) {
+                addDetailRecord(record, keys, name, detail);
+                record->changeLevelUp();
+            }
+            if ( group != "" ) record->changeLevelUp();
+        }
     }
 }
 
+void
+BasicPerfTracker::addDetailRecord(DataRecord* record, std::map<std::string, std::pair<std::string, std::string>>& keys,
+    const std::string& name, const RegionDetail& detail)
+{
+    record->addChild(name);
+    record->setKeys(keys);
+    record->addData("duration", detail.duration);
+    record->addData("count", detail.count);
+
+    UnitAlgebra mem_us("1kB");
+    mem_us *= detail.mem;
+    record->addData("memory_growth", mem_us);
+}
+
 void
 BasicPerfTracker::setReportRegionInfo(Output& output, size_t verbose)
 {
@@ -24,8 +24,28 @@ namespace SST {
 class Output;
 
 namespace Util {
+class DataRecord;
 class PerfReporter;
 
+/**
+   Resources used by one entry in the breakdown of a region (e.g. all
+   the components of one element type)
+ */
+struct RegionDetail
+{
+    double   duration = 0.0;
+    uint64_t mem      = 0; // Growth in max resident set size, in kB
+    uint64_t count    = 0;
+
+    RegionDetail& operator+=(const RegionDetail& other)
+    {
+        duration += other.duration;
+        mem += other.mem;
+        count += other.count;
+        return *this;
+    }
+};
+
 struct RegionPerfInfo
 {
     double      begin_time    = 0.0;
@@ -67,6 +87,13 @@ struct RegionPerfInfo
     // Rank with the max memory
     int rollup_end_mem_max_rank = -1;
 
+    // Optional breakdown of the region (e.g. by element type).
+    // Entries are organized by group, in the order the groups were
+    // added, then by name.  Entries in the "" group are reported
+    // directly under the region, other groups are reported as a child
+    // of the region holding their entries.
+    std::vector<std::pair<std::string, std::map<std::string, RegionDetail>>> details;
+
     RegionPerfInfo(const std::string& tag, size_t level) :
         level(level),
         tag(tag)
@@ -116,6 +143,19 @@ public:
      */
     void endRegion(const std::string& tag);
 
+    /**
+       Add to the resources used by the named detail of a region.
+       Details are local to the rank and are reported as children of
+       the region when the region's children would be reported.
+
+       @param tag Region the detail belongs to
+       @param name Name of the detail
+       @param detail Resources to add to the detail
+       @param group Optional group to report the detail under
+     */
+    void addRegionDetail(
+        const std::string& tag, const std::string& name, const RegionDetail& detail, const std::string& group = "");
+
     ///// Functions to get the local and global information about the execution /////
 
     /**
@@ -232,6 +272,13 @@ private:
      */
     RegionPerfInfo& getRegion(const std::string& tag, const std::string& function_name, bool must_be_ended = true);
 
+    /**
+       Adds a child record for a region detail to the current level of
+       record.  The record is left at the level of the new child.
+     */
+    void addDetailRecord(DataRecord* record, std::map<std::string, std::pair<std::string, std::string>>& keys,
+        const std::string& name, const RegionDetail& detail);
+
 
     // Scalar storage
     std::map<std::string, uint64_t> scalars_unsigned;
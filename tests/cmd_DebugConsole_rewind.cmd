@@ -0,0 +1,17 @@
+confirm false
+run 2500ps
+cd component0
+print message_count_
+cd ..
+run 1000ps
+snapshots
+rewind 0
+time
+cd component0
+print message_count_
+cd ..
+run 500ps
+cd component0
+print message_count_
+cd ..
+shutdown
@@ -0,0 +1,5 @@
+confirm false
+snapshots
+run 3500ps
+snapshots
+shutdown
@@ -0,0 +1,40 @@
+import sst
+import array
+
+# Same model as test_Component.py, but built with the bulk
+# construction functions
+
+# Define SST core options
+sst.setProgramOption("stop-at", "25us")
+
+size = 10
+
+# Define the simulation components.  Component x,y has id first + y * size + x
+first = sst.createComponents("c", "coreTestElement.coreTestComponent", size * size, {
+      "workPerCycle" : "1000",
+      "commSize" : "100",
+      "commFreq" : "1000"
+})
+
+def comp_id(x, y):
+    return first + (y % size) * size + (x % size)
+
+# Define the simulation links.  The north/south links are given as
+# Component objects and the east/west links as an integer array.
+comps = [sst.findComponentByName("c%d" % i) for i in range(size * size)]
+north = [comps[(y + 1) % size * size + x] for y in range(size) for x in range(size)]
+sst.connectComponents("link_ns_", comps, "Nlink", north, "Slink", "10000ps")
+
+west = array.array("q", [comp_id(x, y) for y in range(size) for x in range(size)])
+east = array.array("q", [comp_id(x + 1, y) for y in range(size) for x in range(size)])
+sst.connectComponents("link_ew_", west, ["Elink"] * len(west), east, ["Wlink"] * len(east),
+                      [sst.UnitAlgebra("10ns")] * len(west))
+
+# Parameters that can't be encoded as UTF-8 are reported as an error
+# before any component is created
+try:
+    sst.createComponents("bad", "coreTestElement.coreTestComponent", 1, { "workPerCycle" : "\ud800" })
+except UnicodeEncodeError:
+    pass
+else:
+    raise RuntimeError("createComponents accepted a parameter that can't be encoded as UTF-8")
@@ -0,0 +1,29 @@
+import sst
+
+# Same model as test_Component.py, but built with the native torus
+# graph generator
+
+# Define SST core options
+sst.setProgramOption("stop-at", "25us")
+
+sst.generateGraph("sst.torus", {
+      "shape" : [10, 10],
+      "link_latency" : "10000ps",
+      "port_names" : ["Elink", "Wlink", "Nlink", "Slink"]
+}, {
+      "router" : ("coreTestElement.coreTestComponent", {
+            "workPerCycle" : "1000",
+            "commSize" : "100",
+            "commFreq" : "1000"
+      })
+}, "c")
+
+# Component types and roles that can't be encoded as UTF-8 are
+# reported as an error before any component is created
+for components in ({ "router" : "\ud800" }, { "router" : ("\ud800",) }, { "\ud800" : "coreTestElement.coreTestComponent" }):
+    try:
+        sst.generateGraph("sst.torus", { "shape" : [2, 2] }, components, "bad")
+    except UnicodeEncodeError:
+        pass
+    else:
+        raise RuntimeError("generateGraph accepted a component that can't be encoded as UTF-8")
@@ -0,0 +1,40 @@
+import sst
+import sys
+
+# Same model as test_Component.py, but every component gets its
+# params from a single shared param set.  Also used as a benchmark for
+# component construction: the side of the torus can be given as a
+# model option, so
+#
+#   sst --timing-info --stop-at=1ns test_Component_sharedParams.py --model-options=1000
+#
+# builds 1M components and reports the time spent in construction.
+# The converted values of the shared set are cached unless "nocache"
+# is given as a second model option.  test_Component_sharedParams_benchmark
+# in testsuite_default_Component.py runs both.
+
+# Define SST core options
+sst.setProgramOption("stop-at", "25us")
+
+size = 10
+if len(sys.argv) > 1:
+    size = int(sys.argv[1])
+use_cache = not (len(sys.argv) > 2 and sys.argv[2] == "nocache")
+
+sst.addSharedParams("comp_params", {
+      "workPerCycle" : "1000",
+      "commSize" : "100",
+      "commFreq" : "1000"
+})
+if use_cache:
+    sst.enableSharedParamsCache("comp_params")
+
+# Define the simulation components.  Component x,y is c<y * size + x>
+sst.createComponents("c", "coreTestElement.coreTestComponent", size * size, None, "comp_params")
+
+# Define the simulation links
+comps = [sst.findComponentByName("c%d" % i) for i in range(size * size)]
+north = [comps[(y + 1) % size * size + x] for y in range(size) for x in range(size)]
+east = [comps[y * size + (x + 1) % size] for y in range(size) for x in range(size)]
+sst.connectComponents("link_ns_", comps, "Nlink", north, "Slink", "10000ps")
+sst.connectComponents("link_ew_", comps, "Elink", east, "Wlink", "10000ps")
@@ -65,6 +65,7 @@ for i in range(num_routers):
     comp.addParam("mod",mod)
     comp.addParam("verbose",verbose)
     comp.addParam("stats", stats)
+    comp.setCoordinates(my_x, my_y)
 
     # Setup up all the ports. X ports will use MessagePort directly, Y ports, will use the SlotPort
     port_x_pos = comp.setSubComponent("ports","coreTestElement.message_mesh.message_port",0);
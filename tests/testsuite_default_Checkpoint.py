@@ -13,11 +13,15 @@
 
 import os
 import filecmp
+import glob
+import json
+import struct
 
 from sst_unittest import *
 from sst_unittest_support import *
 
 have_mpi = sst_core_config_include_file_get_value(define="SST_CONFIG_HAVE_MPI", type=int, default=0, disable_warning=True) == 1
+have_zlib = sst_core_config_include_file_get_value(define="HAVE_LIBZ", type=int, default=0, disable_warning=True) == 1
 
 class testcase_Checkpoint(SSTTestCase):
 
@@ -129,6 +133,38 @@ class testcase_Checkpoint(SSTTestCase):
     def test_Checkpoint_Clocks_basic(self) -> None:
         self.checkpoint_test_template("Clocks", 1, 2, out_suffix="_basic")
 
+    def test_Checkpoint_Clocks_basic_incremental(self) -> None:
+        self.checkpoint_test_template("Clocks", 2, 2, out_suffix="_basic", cpt_suffix="_incremental", cpt_args="--checkpoint-incremental")
+
+        # Some components don't change between checkpoints, so the
+        # registries must list blobs that refer to an earlier checkpoint
+        outdir = test_output_get_run_dir()
+        registries = glob.glob("{0}/testsuite_checkpoint/Clocks_basic_incremental_cpt/*/*.sstcpt".format(outdir))
+        self.assertTrue(registries, "No checkpoint registries found for incremental checkpoint")
+        references = 0
+        for registry in registries:
+            with open(registry, 'r') as f:
+                references += sum(1 for line in f if " -> ../" in line)
+        self.assertTrue(references > 0, "Incremental checkpoint did not write any references to earlier checkpoints")
+
+    def test_Checkpoint_Clocks_basic_aggregate(self) -> None:
+        self.checkpoint_test_template("Clocks", 1, 2, out_suffix="_basic", n_to_one=True, cpt_suffix="_aggregate", cpt_args="--checkpoint-aggregate=1 --checkpoint-incremental --checkpoint-compress")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_Checkpoint_Clocks_basic_aggregate_mpi(self) -> None:
+        # Two ranks write each checkpoint into one shared file at
+        # their own offsets, which a serial restart must read back
+        self.checkpoint_test_template("Clocks", 1, 2, out_suffix="_basic", n_to_one=True, cpt_suffix="_aggregate_mpi", cpt_args="--checkpoint-aggregate=2", cpt_ranks=2, cpt_threads=2)
+
+        outdir = test_output_get_run_dir()
+        cpt_dirs = glob.glob("{0}/testsuite_checkpoint/Clocks_basic_aggregate_mpi_cpt/Clocks_basic_aggregate_mpi_cpt_*/".format(outdir))
+        self.assertTrue(cpt_dirs, "No checkpoints found for aggregated checkpoint")
+        for cpt_dir in cpt_dirs:
+            cpt_dir = os.path.normpath(cpt_dir)
+            name = os.path.basename(cpt_dir)
+            data_files = [f for f in glob.glob("{0}/*.bin".format(cpt_dir)) if not f.endswith("_globals.bin")]
+            self.assertEqual(data_files, ["{0}/{1}_0.bin".format(cpt_dir, name)], "Checkpoint {0} was not written to a single shared file".format(cpt_dir))
+
     def test_Checkpoint_Clocks_basic_n2one(self) -> None:
         self.checkpoint_test_template("Clocks", 1, 2, out_suffix="_basic", n_to_one=True, cpt_suffix="_n2one")
 
@@ -175,6 +211,70 @@ class testcase_Checkpoint(SSTTestCase):
     def test_Checkpoint_MessageMesh(self) -> None:
         self.checkpoint_test_template("MessageMesh", 1, 1, modelparams="6 6")
 
+    def test_Checkpoint_MessageMesh_async(self) -> None:
+        self.checkpoint_test_template("MessageMesh", 1, 1, modelparams="6 6", cpt_suffix="_async", cpt_args="--checkpoint-async")
+
+        # The registry and index are renamed into place once the data
+        # files have been written
+        outdir = test_output_get_run_dir()
+        cptdir = "{0}/testsuite_checkpoint/MessageMesh_async_cpt".format(outdir)
+        pending = glob.glob("{0}/*/*.pending".format(cptdir))
+        self.assertFalse(pending, "Checkpoint files were left pending: {0}".format(pending))
+        registries = glob.glob("{0}/*/*.sstcpt".format(cptdir))
+        indexes = glob.glob("{0}/*/*.sstidx".format(cptdir))
+        self.assertTrue(registries and len(registries) == len(indexes),
+                        "Missing registry or index files in {0}".format(cptdir))
+
+    def test_Checkpoint_MessageMesh_compress(self) -> None:
+        self.checkpoint_test_template("MessageMesh", 1, 2, modelparams="6 6", n_to_one=True, cpt_suffix="_compress", cpt_args="--checkpoint-compress")
+
+        if not have_zlib:
+            return
+
+        # The data files must be in the compressed format and smaller
+        # than the uncompressed data, whose size is recorded in the
+        # index at the end of the file
+        outdir = test_output_get_run_dir()
+        cptdir = "{0}/testsuite_checkpoint/MessageMesh_compress_cpt/MessageMesh_compress_cpt_1".format(outdir)
+        binfiles = glob.glob("{0}/*.bin".format(cptdir))
+        self.assertTrue(binfiles, "No checkpoint data files found in {0}".format(cptdir))
+        for binfile in binfiles:
+            with open(binfile, "rb") as f:
+                data = f.read()
+            self.assertEqual(data[:8], b"SSTCPTZ1", "{0} is not a compressed checkpoint file".format(binfile))
+            self.assertEqual(data[-8:], b"SSTCPTZ1", "{0} is missing the compressed file trailer".format(binfile))
+            index_offset, = struct.unpack("=Q", data[-16:-8])
+            raw_size, = struct.unpack("=Q", data[index_offset:index_offset + 8])
+            self.assertLess(len(data), raw_size, "{0} ({1} bytes) is not smaller than its uncompressed data ({2} bytes)"
+                            .format(binfile, len(data), raw_size))
+
+    def test_Checkpoint_MessageMesh_profile(self) -> None:
+        self.checkpoint_test_template("MessageMesh", 1, 1, modelparams="6 6", cpt_suffix="_profile", cpt_args="--checkpoint-profile")
+
+        # Check the totals of the profile of the first checkpoint
+        outdir = test_output_get_run_dir()
+        jsonfile = "{0}/testsuite_checkpoint/MessageMesh_profile_cpt/MessageMesh_profile_cpt_1/MessageMesh_profile_cpt_1_profile.json".format(outdir)
+        with open(jsonfile) as f:
+            profile = json.load(f)
+
+        self.assertEqual(profile["partitions"], testing_check_get_num_ranks() * testing_check_get_num_threads(),
+                         "Wrong number of partitions in {0}".format(jsonfile))
+        # Nothing is serialized for the time vortex itself, it is
+        # included with the links
+        for section in ["simulation", "components", "links", "statistics", "time_vortex"]:
+            self.assertTrue(section in profile["sections"], "Profile is missing section {0}".format(section))
+            totals = profile["sections"][section]
+            self.assertGreater(totals["count"], 0, "Section {0} has no items".format(section))
+            if section != "time_vortex":
+                self.assertGreater(totals["bytes"], 0, "Section {0} has no bytes".format(section))
+
+        elem_type = "coreTestElement.message_mesh.enclosing_component"
+        self.assertTrue(elem_type in profile["component_types"], "Profile is missing type {0}".format(elem_type))
+        totals = profile["component_types"][elem_type]
+        self.assertEqual(totals["count"], 36, "Wrong number of {0} components in the profile".format(elem_type))
+        self.assertGreater(totals["bytes"], 0, "Type {0} has no bytes".format(elem_type))
+        self.assertGreater(profile["pointer_tracking"]["pointers"], 0, "No pointers were tracked")
+
     def test_Checkpoint_MessageMesh_n2one(self) -> None:
         self.checkpoint_test_template("MessageMesh", 1, 2, modelparams="6 6", n_to_one=True, cpt_suffix="_n2one")
 
@@ -246,7 +346,8 @@ class testcase_Checkpoint(SSTTestCase):
     # cr_index: checkpoint index to restart from when restarting from a checkpointed restart run
     # subcom: Set to True if this is a subcomponent test as the file/path name differs
     # modelparams: Set what is passed into --model-params when running SST
-    def checkpoint_test_template(self, testtype: str, rst_index: int = 1, cr_index: int = 0, subcomp: bool = False, modelparams: str = "", out_suffix: str = "", cpt_suffix : str = "", n_to_one: bool = False, swap_rank_thread : bool = False, start_serial : bool = False, restart_smaller : bool = False) -> None:
+    # cpt_args: Additional options passed to the runs that create checkpoints
+    def checkpoint_test_template(self, testtype: str, rst_index: int = 1, cr_index: int = 0, subcomp: bool = False, modelparams: str = "", out_suffix: str = "", cpt_suffix : str = "", n_to_one: bool = False, swap_rank_thread : bool = False, start_serial : bool = False, restart_smaller : bool = False, cpt_args : str = "", cpt_ranks : int = 0, cpt_threads : int = 0) -> None:
 
         # name conventions:
         # X_cpt - files/options associated with first checkpoint run
@@ -293,11 +394,14 @@ class testcase_Checkpoint(SSTTestCase):
         options_checkpoint_cpt = (
             "--checkpoint-sim-period='{0}' --checkpoint-prefix={1} "
             "--checkpoint-name-format='%p_%n' --output-directory=testsuite_checkpoint "
-            "--model-options='{2}'".format(checkpoint_period, prefix_cpt, modelparams))
+            "--model-options='{2}' {3}".format(checkpoint_period, prefix_cpt, modelparams, cpt_args))
 
         if start_serial:
             # Need to run with 1 rank and 1 thread
             self.run_sst(sdlfile_cpt, outfile_cpt, other_args=options_checkpoint_cpt, num_ranks=1, num_threads=1)
+        elif cpt_ranks > 0:
+            # Test needs a specific number of ranks and threads
+            self.run_sst(sdlfile_cpt, outfile_cpt, other_args=options_checkpoint_cpt, num_ranks=cpt_ranks, num_threads=max(cpt_threads, 1))
         else:
             self.run_sst(sdlfile_cpt, outfile_cpt, other_args=options_checkpoint_cpt)
 
@@ -324,8 +428,8 @@ class testcase_Checkpoint(SSTTestCase):
         if cr_index > 0:
             options_checkpoint_rst = (
                 " --checkpoint-sim-period='{0}' --checkpoint-prefix={1} "
-                "--checkpoint-name-format='%p_%n' --output-directory=testsuite_checkpoint "
-                .format(checkpoint_period, prefix_rst))
+                "--checkpoint-name-format='%p_%n' --output-directory=testsuite_checkpoint {2}"
+                .format(checkpoint_period, prefix_rst, cpt_args))
 
         options_rst += options_checkpoint_rst
 
@@ -11,6 +11,9 @@
 # information, see the LICENSE file in the top level directory of the
 # distribution.
 
+import json
+import os
+
 from sst_unittest import *
 from sst_unittest_support import *
 
@@ -33,18 +36,58 @@ class testcase_Component(SSTTestCase):
     def test_Component_time_overflow(self):
         self.component_test_template("Component_time_overflow", 1)
 
+    def test_Component_bulk(self):
+        self.component_test_template("Component_bulk", reftype = "Component")
+
+    def test_Component_sharedParams(self):
+        self.component_test_template("Component_sharedParams", reftype = "Component")
+
+    # Construction benchmark for shared params, with and without the
+    # value cache.  Use a larger size (e.g. SST_SHARED_PARAMS_BENCH_SIZE=1000
+    # for 1M components) to benchmark at scale.
+    def test_Component_sharedParams_benchmark(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_Component_sharedParams.py".format(testsuitedir)
+        size = int(os.environ.get("SST_SHARED_PARAMS_BENCH_SIZE", "50"))
+        elem_type = "coreTestElement.coreTestComponent"
+
+        for mode in ["cache", "nocache"]:
+            outfile = "{0}/test_Component_sharedParams_benchmark_{1}.out".format(outdir, mode)
+            jsonfile = "{0}/test_Component_sharedParams_benchmark_{1}.json".format(outdir, mode)
+            self.run_sst(sdlfile, outfile, other_args = '--stop-at=1ns --timing-info=4 --profiling-output={0} '
+                         '--model-options="{1} {2}"'.format(jsonfile, size, mode))
+
+            with open(jsonfile) as f:
+                construct = json.load(f)['regions']['total']['build']['construct']
+            self.assertTrue(elem_type in construct, "construct region is missing element type {0}".format(elem_type))
+            self.assertEqual(construct[elem_type]["count"], str(size * size),
+                             "construct cost of {0} has wrong count".format(elem_type))
+            log_forced("Construction of {0} components ({1}): {2}".format(size * size, mode,
+                                                                         construct[elem_type]["duration"]))
+
+    def test_Component_generated(self):
+        self.component_test_template("Component_generated", reftype = "Component")
+
+    def test_Component_parallelConstruction(self):
+        self.component_test_template("Component_parallelConstruction", sdltype = "Component", reftype = "Component",
+                                     other_args = "--parallel-construction", num_threads = 2)
+
 #####
 
-    def component_test_template(self, testtype, exp_rc = 0):
+    def component_test_template(self, testtype, exp_rc = 0, reftype = None, sdltype = None, other_args = "",
+                                num_threads = None):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
-        sdlfile = "{0}/test_{1}.py".format(testsuitedir, testtype)
-        reffile = "{0}/refFiles/test_{1}.out".format(testsuitedir, testtype)
+        sdlfile = "{0}/test_{1}.py".format(testsuitedir, sdltype if sdltype else testtype)
+        reffile = "{0}/refFiles/test_{1}.out".format(testsuitedir, reftype if reftype else testtype)
         outfile = "{0}/test_{1}.out".format(outdir, testtype)
         errfile = "{0}/test_{1}.err".format(outdir, testtype)
 
-        self.run_sst(sdlfile, outfile, errfile, expected_rc = exp_rc)
+        self.run_sst(sdlfile, outfile, errfile, other_args = other_args, num_threads = num_threads,
+                     expected_rc = exp_rc)
 
         # Check the results if exp_rc isn't equal to 0, then we are
         # expecting an error and we'll put in a LineFilter to filter
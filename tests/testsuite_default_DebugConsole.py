@@ -105,14 +105,26 @@ class testcase_DebugConsole(SSTTestCase):
     def test_tracebuf(self):
         self.debugconsole_test_template("tracebuf", "0")
 
+    # Test listing of checkpoints kept in memory
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test only supports serial execution")
+    @unittest.skipIf(testing_check_get_num_threads() > 1, "Test only supports serial execution")
+    def test_snapshots(self):
+        self.debugconsole_test_template("snapshots", "0", "--checkpoint-sim-period=1ns --checkpoint-memory=2")
+
+    # Test rewinding to a checkpoint kept in memory and resuming from it
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Test only supports serial execution")
+    @unittest.skipIf(testing_check_get_num_threads() > 1, "Test only supports serial execution")
+    def test_rewind(self):
+        self.debugconsole_test_template("rewind", "0", "--checkpoint-sim-period=1ns --checkpoint-memory=2")
+
 #####
 
-    def debugconsole_test_template(self, testtype, starttime):
+    def debugconsole_test_template(self, testtype, starttime, other_options=""):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
         cmdfile = "{0}/cmd_DebugConsole_{1}.cmd".format(testsuitedir, testtype)
-        options = "--interactive-start={1} --replay-file={0} --model-options=\"4 4\"".format(cmdfile, starttime);
+        options = "--interactive-start={1} --replay-file={0} --model-options=\"4 4\" {2}".format(cmdfile, starttime, other_options);
 
         # Set the various file paths
         sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
@@ -132,11 +144,16 @@ class testcase_DebugConsole(SSTTestCase):
         # Filter out variable types due to differences across architectures
         filter3 = LineFilter();
         filter3 = RemoveRegexFromLineFilter(r"std::.*")
+        # Filter out checkpoint sizes which vary with the platform
+        filter4 = LineFilter();
+        filter4 = RemoveRegexFromLineFilter(r"\(\d+ bytes\)")
+        filter5 = LineFilter();
+        filter5 = RemoveRegexFromLineFilter(r"\(Real CPU time.*")
 
 
         # Perform the test comparison with refFile
         #cmp_result = testing_compare_sorted_diff(testtype, outfile, reffile)
-        cmp_result = testing_compare_filtered_diff(testtype, outfile, reffile, sort=True, filters=[filter1, filter2, filter3])
+        cmp_result = testing_compare_filtered_diff(testtype, outfile, reffile, sort=True, filters=[filter1, filter2, filter3, filter4, filter5])
         if not cmp_result:
             diffdata = testing_get_diff_data(testtype)
             log_failure(diffdata)
@@ -54,6 +54,9 @@ class testcase_Serialization(SSTTestCase):
     def test_Serialization_pointer_tracking(self):
         self.serialization_test_template("pointer_tracking")
 
+    def test_Serialization_pointer_set(self):
+        self.serialization_test_template("pointer_set")
+
     def test_Serialization_handler(self):
         self.serialization_test_template("handler", False)
 
@@ -78,6 +81,12 @@ class testcase_Serialization(SSTTestCase):
     def test_Serialization_aggregate(self):
         self.serialization_test_template("aggregate")
 
+    def test_Serialization_single_pass(self):
+        self.serialization_test_template("single_pass")
+
+    def test_Serialization_bulk_copy(self):
+        self.serialization_test_template("bulk_copy")
+
 #####
     def serialization_test_template(self, testtype, default_reffile = True):
 
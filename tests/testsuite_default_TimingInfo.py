@@ -32,6 +32,37 @@ class testcase_TimingInfo(SSTTestCase):
     def test_TimingInfo(self):
         self.timing_info_test_template("JSONTimingInfo")
 
+    def test_TimingInfo_elementCosts(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_PerfComponent.py".format(testsuitedir)
+        outfile = "{0}/test_TimingInfo_elementCosts.out".format(outdir)
+        jsonfile = "{0}/test_TimingInfo_elementCosts.json".format(outdir)
+
+        self.run_sst(sdlfile, outfile, other_args=f"--timing-info=4 --profiling-output={jsonfile}")
+
+        jsonDict = {}
+        try:
+            with open(jsonfile) as f:
+                jsonDict = json.load(f)
+        except FileNotFoundError:
+            self.assertFalse(True, f"Could not load json timing info file {jsonfile}")
+
+        # Each startup phase should report the cost of the element type
+        regions = jsonDict['regions']['total']
+        elem_type = "coreTestElement.coreTestPerfComponent"
+        phases = {
+            "construct": regions['build']['construct'],
+            "init": regions['execute']['init']['phase 0'],
+            "setup": regions['execute']['setup'],
+        }
+        for phase, region in phases.items():
+            self.assertTrue(elem_type in region, f"{phase} region is missing element type {elem_type}")
+            for k in ["count", "duration", "memory_growth"]:
+                self.assertTrue(k in region[elem_type], f"{phase} cost of {elem_type} is missing key: {k}")
+            self.assertEqual(region[elem_type]["count"], "16", f"{phase} cost of {elem_type} has wrong count")
+
 #####
 
     def timing_info_test_template(self, testtype):
@@ -53,6 +53,40 @@ class testcase_Config_input_output(SSTTestCase):
     def test_json_io_parallel(self):
         self.configio_test_template("json_io_parallel", "6 6", "json", True, "MULTI")
 
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_json_single_parallel_load(self):
+        self.configio_test_template("json_single_parallel_load", "6 6", "json", False, "SINGLE",
+                                    extra_args="--output-json-index")
+
+    def test_json_io_index(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # The index is only written when asked for
+        self.configio_test_template("json_io_index", "6 6", "json", False, "SINGLE", extra_args="--output-json-index")
+        index = "{0}/testsuite_configio/test_configio_json_io_index.json.idx".format(outdir)
+        self.assertTrue(os.path.isfile(index), "JSON index {0} was not written".format(index))
+        with open(index, "rb") as f:
+            self.assertEqual(f.read(8), b"SSTJSIDX", "JSON index {0} has the wrong magic".format(index))
+
+        self.configio_test_template("json_io_noindex", "6 6", "json", False, "NONE")
+        noindex = "{0}/testsuite_configio/test_configio_json_io_noindex.json.idx".format(outdir)
+        self.assertFalse(os.path.exists(noindex), "JSON index {0} was written without --output-json-index".format(noindex))
+
+    def test_binary_io(self):
+        self.configio_test_template("binary_io", "6 6", "sstgraph", False, "NONE")
+
+    def test_binary_io_comp(self):
+        self.configio_test_template("binary_io_comp", "", "sstgraph", False, "NONE", True)
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_binary_io_parallel(self):
+        self.configio_test_template("binary_io_parallel", "6 6", "sstgraph", True, "MULTI")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_binary_single_parallel_load(self):
+        self.configio_test_template("binary_single_parallel_load", "6 6", "sstgraph", False, "SINGLE")
+
 
     @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
     def test_python_single_parallel_load(self):
@@ -80,7 +114,8 @@ class testcase_Config_input_output(SSTTestCase):
 
 #####
 
-    def configio_test_template(self, testtype, model_options, output_type, parallel_io, load_mode, use_component_test=False):
+    def configio_test_template(self, testtype, model_options, output_type, parallel_io, load_mode, use_component_test=False,
+                               extra_args=""):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
@@ -88,6 +123,7 @@ class testcase_Config_input_output(SSTTestCase):
         output_config_option = "test_configio_{0}.{1}".format(testtype,output_type)
         if ( output_type == "py" ): out_flag = "--output-config"
         elif ( output_type == "json"): out_flag = "--output-json"
+        elif ( output_type == "sstgraph"): out_flag = "--output-binary-graph"
         else:
             print("Unknown output type: {0}".format(output_type))
             sys.exit(1)
@@ -99,6 +135,7 @@ class testcase_Config_input_output(SSTTestCase):
             options_ref = "{0}={1} --parallel-output --model-options=\"{2}\" {3}".format(out_flag,output_config_option,model_options,output_dir_option);
         else:
             options_ref = "{0}={1} --output-partition --model-options=\"{2}\" {3}".format(out_flag,output_config_option,model_options,output_dir_option);
+        options_ref += " " + extra_args
 
         if have_mpi:
             options_check = "--parallel-load={0}".format(load_mode)
@@ -18,6 +18,9 @@ from sst_unittest import *
 from sst_unittest_support import *
 
 
+have_mpi = sst_core_config_include_file_get_value(define="SST_CONFIG_HAVE_MPI", type=int, default=0, disable_warning=True) == 1
+
+
 class testcase_Partitioners(SSTTestCase):
 
     def setUp(self):
@@ -40,6 +43,98 @@ class testcase_Partitioners(SSTTestCase):
     def test_simple(self):
         self.partitioner_test_template("simple", "6 6", "sst.simple")
 
+    def test_multilevel(self):
+        self.partitioner_test_template("multilevel", "6 6", "sst.multilevel")
+
+    def test_lookahead(self):
+        self.partitioner_test_template("lookahead", "6 6", "sst.lookahead")
+
+    def test_rcb(self):
+        self.partitioner_test_template("rcb", "6 6", "sst.rcb")
+
+    def test_inertial(self):
+        self.partitioner_test_template("inertial", "6 6", "sst.inertial")
+
+    def test_ranklocal(self):
+        self.partitioner_test_template("ranklocal", "6 6", "sst.ranklocal")
+
+    def test_multilevel_imbalance(self):
+        self.partitioner_test_template("multilevel_imbalance", "6 6", "sst.multilevel --partitioner-imbalance=1.1")
+
+    def test_invalid_imbalance(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # The imbalance is a ratio of maximum to average load, so it
+        # must be a finite number of at least 1.0
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        for i, value in enumerate(["0.5", "-1", "nan", "inf", "abc"]):
+            outfile = "{0}/test_partitioner_invalid_imbalance_{1}.out".format(outdir, i)
+            errfile = "{0}/test_partitioner_invalid_imbalance_{1}.err".format(outdir, i)
+            options = "--partitioner=sst.multilevel --partitioner-imbalance={0}".format(value)
+            self.run_sst(sdlfile, outfile, errfile, other_args=options, expected_rc=255, num_ranks=1, num_threads=1)
+            with open(errfile) as f:
+                err = f.read()
+            self.assertTrue("--partitioner-imbalance" in err,
+                            "Invalid imbalance {0} was not reported: {1}".format(value, err))
+
+    def test_multilevel_weights(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # Measure the partition weights with a serial run, then use
+        # them to partition
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        weightfile = "{0}/test_partitioner_weights.txt".format(outdir)
+        outfile = "{0}/test_partitioner_measure_weights.out".format(outdir)
+        options = "--model-options=\"6 6\" --output-partition-weights={0}".format(weightfile)
+        self.run_sst(sdlfile, outfile, other_args=options, num_ranks=1, num_threads=1)
+        self.assertTrue(os.path.isfile(weightfile), "Partition weights file {0} was not written".format(weightfile))
+
+        self.partitioner_test_template("multilevel_weights", "6 6",
+                                       "sst.multilevel --partition-weights={0}".format(weightfile))
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_ranklocal_parallel_load(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # Write the graph split across the ranks by round robin, which
+        # cuts most of the links, then load it in parallel so that the
+        # rank local partitioner has to move components between ranks.
+        # Both ranks load the same number of components, so refinement
+        # needs some room above a perfect balance to move any of them.
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        graphfile = "{0}/test_partitioner_ranklocal_parallel.json".format(outdir)
+        outfile_ref = "{0}/test_partitioner_ref_ranklocal_parallel.out".format(outdir)
+        outfile_write = "{0}/test_partitioner_write_ranklocal_parallel.out".format(outdir)
+        outfile_check = "{0}/test_partitioner_check_ranklocal_parallel.out".format(outdir)
+        outfile_verbose = "{0}/test_partitioner_verbose_ranklocal_parallel.out".format(outdir)
+
+        self.run_sst(sdlfile, outfile_ref, other_args="--model-options=\"6 6\"", num_ranks=1, num_threads=1)
+
+        options = "--model-options=\"6 6\" --partitioner=sst.roundrobin --parallel-output --output-json={0}".format(graphfile)
+        self.run_sst(sdlfile, outfile_write, other_args=options, num_ranks=2, num_threads=1)
+
+        options = "--parallel-load=MULTI --partitioner=sst.ranklocal --partitioner-imbalance=1.3"
+        self.run_sst(graphfile, outfile_check, other_args=options, num_ranks=2, num_threads=1, check_sdl_file=False)
+
+        cmp_result = testing_compare_sorted_diff("ranklocal_parallel", outfile_ref, outfile_check)
+        if not cmp_result:
+            diffdata = testing_get_diff_data("ranklocal_parallel")
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_ref, outfile_check))
+
+        # Make sure components were actually moved between the ranks
+        self.run_sst(graphfile, outfile_verbose, other_args=options + " --verbose", num_ranks=2, num_threads=1,
+                     check_sdl_file=False)
+        moved = 0
+        with open(outfile_verbose) as f:
+            for line in f:
+                if "Vertices moved by refinement:" in line:
+                    moved = int(line.split(":")[-1])
+        self.assertTrue(moved > 0, "No components were moved between ranks, see {0}".format(outfile_verbose))
+
 #####
 
     def partitioner_test_template(self, testtype, model_options, partitioner):
@@ -36,6 +36,99 @@ class testcase_sstinfo(SSTTestCase):
     def test_sstinfo_interactive(self):
         self.sstinfo_test_template("interactive", "-i")
 
+    def test_sstinfo_index(self):
+        outdir = test_output_get_run_dir()
+        indexfile = "{0}/test_sstinfo_index.idx".format(outdir)
+
+        # The index is only written when asked for
+        self.write_elemlib_index("index_noflag", indexfile, "")
+        self.assertFalse(os.path.exists(indexfile), "sst-info wrote the element library index without being asked to")
+
+        # The index should list the library
+        self.write_elemlib_index("index", indexfile)
+        self.assertTrue(os.path.isfile(indexfile), "sst-info did not write the element library index {0}".format(indexfile))
+        self.assertTrue(self.find_elemlib_dir(indexfile) is not None,
+                        "Element library index {0} is missing coreTestElement".format(indexfile))
+
+    def test_sstinfo_index_load(self):
+        outdir = test_output_get_run_dir()
+        indexfile = "{0}/test_sstinfo_index_load.idx".format(outdir)
+        self.write_elemlib_index("index_load", indexfile)
+        libdir = self.find_elemlib_dir(indexfile)
+        self.assertTrue(libdir is not None, "Element library index {0} is missing coreTestElement".format(indexfile))
+
+        # The library is found through the index
+        output = self.run_with_elemlib_index("index_load", indexfile, 0)
+        self.assertTrue("Load was successful" in output, "sst did not load coreTestElement through the index")
+        self.assertFalse("out of date" in output, "Element library index {0} was not current".format(indexfile))
+
+        # Directories that are current in the index are not searched
+        # for libraries that the index doesn't list, so removing the
+        # library from the index makes it impossible to load
+        with open(indexfile, 'r') as f:
+            lines = f.readlines()
+        missing = [l for l in lines if not l.startswith("lib\tlibcoreTestElement.")]
+        with open(indexfile, 'w') as f:
+            f.writelines(missing)
+        output = self.run_with_elemlib_index("index_missing", indexfile, None)
+        self.assertTrue("not in element library index, skipping" in output,
+                        "sst did not use the element library index {0}".format(indexfile))
+
+        # If the directory has changed since the index was written,
+        # it is searched again
+        with open(indexfile, 'w') as f:
+            for l in missing:
+                fields = l.rstrip('\n').split('\t')
+                if fields[0] == "dir" and fields[1] == libdir:
+                    l = "dir\t{0}\t1\n".format(libdir)
+                f.write(l)
+        output = self.run_with_elemlib_index("index_stale", indexfile, 0)
+        self.assertTrue("out of date" in output, "sst did not detect the stale element library index")
+        self.assertTrue("Load was successful" in output, "sst did not fall back to searching for coreTestElement")
+
+    def write_elemlib_index(self, testtype, indexfile, flags = "--write-elemlib-index"):
+        outdir = test_output_get_run_dir()
+        outfile = "{0}/test_sstinfo_{1}.out".format(outdir, testtype)
+        errfile = "{0}/test_sstinfo_{1}.err".format(outdir, testtype)
+        if os.path.exists(indexfile):
+            os.remove(indexfile)
+
+        sst_app_path = sstsimulator_conf_get_value(section='SSTCore', key='bindir', type=str, default="UNDEFINED")
+        cmd = 'env SST_CORE_ELEMLIB_INDEX={0} {1}/sst-info coreTestElement -q {2}'.format(indexfile, sst_app_path, flags)
+        rtn = os_command(cmd, output_file_path = outfile, error_file_path = errfile).run(timeout_sec = 5)
+        self.assertEqual(rtn.result(), 0, "sst-info Test failed running cmdline {0} - return = {1}".format(cmd, rtn.result()))
+
+    # Returns the directory holding coreTestElement in the index
+    def find_elemlib_dir(self, indexfile):
+        libdir = None
+        with open(indexfile, 'r') as f:
+            for line in f:
+                fields = line.rstrip('\n').split('\t')
+                if fields[0] == "dir":
+                    dirname = fields[1]
+                elif fields[0] == "lib" and fields[1].startswith("libcoreTestElement."):
+                    libdir = dirname
+        return libdir
+
+    # Runs sst with the index and verbose library loading, returning
+    # the output.  exp_rc of None means any nonzero return code.
+    def run_with_elemlib_index(self, testtype, indexfile, exp_rc):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+        outfile = "{0}/test_sstinfo_{1}_sst.out".format(outdir, testtype)
+        errfile = "{0}/test_sstinfo_{1}_sst.err".format(outdir, testtype)
+
+        sst_app_path = sstsimulator_conf_get_value(section='SSTCore', key='bindir', type=str, default="UNDEFINED")
+        cmd = 'env SST_CORE_ELEMLIB_INDEX={0} SST_CORE_DL_VERBOSE=1 {1}/sst --stop-at=1ns {2}/test_Component.py'.format(
+            indexfile, sst_app_path, testsuitedir)
+        rtn = os_command(cmd, output_file_path = outfile, error_file_path = errfile).run(timeout_sec = 60)
+        if exp_rc is None:
+            self.assertNotEqual(rtn.result(), 0, "sst unexpectedly succeeded running cmdline {0}".format(cmd))
+        else:
+            self.assertEqual(rtn.result(), exp_rc, "sst failed running cmdline {0} - return = {1}".format(cmd, rtn.result()))
+        with open(outfile, 'r') as f:
+            return f.read()
+
 #####
 
     def sstinfo_test_template(self, testtype, flags):